@@ -0,0 +1,336 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "max_heap/max_heap.h"
+#include "heapsort/heapsort.h"
+#ifndef _WIN32
+#include <unistd.h> // sysconf
+#endif
+#include "bench_tempo.h"
+#include "bench_util.h"
+#include "bench_secoes.h"
+
+// Operações por amostra de latência nas operações individuais. Medir cada
+// operação isoladamente custaria mais que a própria operação; o percentil é
+// calculado sobre a média de cada grupo de BENCH_OPS_POR_AMOSTRA operações.
+#define BENCH_OPS_POR_AMOSTRA 128
+
+// Número aproximado de operações medidas por ponto (tamanho, distribuição):
+// tamanhos pequenos são repetidos até atingir esse volume.
+#define BENCH_OPS_ALVO 1000000LL
+
+// Operações medidas na suíte principal
+typedef enum {
+    OP_INSERIR,
+    OP_EXTRAIR,
+    OP_MISTO,
+    OP_CONSTRUCAO,
+    OP_HEAPSORT,
+    OP_QUANTIDADE
+} OperacaoBench;
+
+static const char *nomesOperacoes[OP_QUANTIDADE] = {
+    "inserir", "extrair", "misto", "construcao", "heapsort"
+};
+
+// Amostras de ns/op acumuladas para o ponto em medição
+static double *amostras;
+static long long nAmostras;
+static long long capacidadeAmostras;
+
+/**
+ * @brief Registra uma amostra de 'ops' operações que levaram 'ns' nanossegundos.
+ */
+static void registrarAmostra(double ns, long long ops) {
+    if (ops <= 0) return;
+    if (nAmostras == capacidadeAmostras) {
+        long long nova = capacidadeAmostras < 1024 ? 1024 : capacidadeAmostras * 2;
+        double *novo = (double*) realloc(amostras, (size_t) nova * sizeof(double));
+        if (novo == NULL) return;
+        amostras = novo;
+        capacidadeAmostras = nova;
+    }
+    amostras[nAmostras++] = ns / (double) ops;
+}
+
+/**
+ * @brief Executa uma repetição da operação 'op' sobre 'entrada' (n pacientes),
+ * registrando as amostras. 'extra' fornece os pacientes inseridos no modo misto.
+ * @return Número de operações executadas, ou -1 em caso de falha de memória.
+ */
+static long long executarRepeticao(OperacaoBench op, const Paciente entrada[], const Paciente extra[],
+                                   Paciente trabalho[], int n) {
+    MaxHeap *heap = NULL;
+    long long ops = 0;
+    double inicio;
+
+    switch (op) {
+        case OP_INSERIR:
+            heap = criarMaxHeap(n);
+            if (heap == NULL) return -1;
+            for (int i = 0; i < n; i += BENCH_OPS_POR_AMOSTRA) {
+                int fim = i + BENCH_OPS_POR_AMOSTRA < n ? i + BENCH_OPS_POR_AMOSTRA : n;
+                inicio = benchAgoraNs();
+                for (int j = i; j < fim; j++) {
+                    inserirPacienteMax(heap, entrada[j]);
+                }
+                registrarAmostra(benchAgoraNs() - inicio, fim - i);
+            }
+            ops = n;
+            break;
+
+        case OP_EXTRAIR:
+            heap = criarMaxHeapDeArray((Paciente*) entrada, n, 0);
+            if (heap == NULL) return -1;
+            while (!maxHeapVazia(heap)) {
+                int k = heap->tamanho < BENCH_OPS_POR_AMOSTRA ? heap->tamanho : BENCH_OPS_POR_AMOSTRA;
+                inicio = benchAgoraNs();
+                for (int j = 0; j < k; j++) {
+                    extrairMaxPacienteHeap(heap);
+                }
+                registrarAmostra(benchAgoraNs() - inicio, k);
+            }
+            ops = n;
+            break;
+
+        case OP_MISTO:
+            // Regime estacionário: heap com n pacientes, inserções e extrações alternadas
+            heap = criarMaxHeapDeArray((Paciente*) entrada, n, 0);
+            if (heap == NULL || reservarMaxHeap(heap, n + 1) != HEAP_OK) {
+                liberarMaxHeap(heap);
+                return -1;
+            }
+            for (int i = 0; i < n; i += BENCH_OPS_POR_AMOSTRA / 2) {
+                int fim = i + BENCH_OPS_POR_AMOSTRA / 2 < n ? i + BENCH_OPS_POR_AMOSTRA / 2 : n;
+                inicio = benchAgoraNs();
+                for (int j = i; j < fim; j++) {
+                    inserirPacienteMax(heap, extra[j]);
+                    extrairMaxPacienteHeap(heap);
+                }
+                registrarAmostra(benchAgoraNs() - inicio, 2LL * (fim - i));
+            }
+            ops = 2LL * n;
+            break;
+
+        case OP_CONSTRUCAO:
+            // A heap adota 'trabalho', então o buffer precisa vir do malloc
+            {
+                Paciente *buffer = (Paciente*) malloc((size_t) (n > 0 ? n : 1) * sizeof(Paciente));
+                if (buffer == NULL) return -1;
+                memcpy(buffer, entrada, (size_t) n * sizeof(Paciente));
+                inicio = benchAgoraNs();
+                heap = criarMaxHeapDeArray(buffer, n, 1);
+                registrarAmostra(benchAgoraNs() - inicio, n);
+                if (heap == NULL) {
+                    free(buffer);
+                    return -1;
+                }
+            }
+            ops = n;
+            break;
+
+        case OP_HEAPSORT:
+            memcpy(trabalho, entrada, (size_t) n * sizeof(Paciente));
+            inicio = benchAgoraNs();
+            heapsortPacientes(trabalho, n);
+            registrarAmostra(benchAgoraNs() - inicio, n);
+            ops = n;
+            break;
+
+        default:
+            break;
+    }
+    liberarMaxHeap(heap);
+    return ops;
+}
+
+/**
+ * @brief Mede todas as operações e distribuições para tamanhos de 'nMin' a
+ * 'nMax' (potências de 10), emitindo um resultado por ponto.
+ * @return EXIT_SUCCESS ou EXIT_FAILURE (falta de memória).
+ */
+static int executarSuite(long long nMin, long long nMax) {
+    for (long long n = nMin; n <= nMax; n *= 10) {
+        Paciente *entrada = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        Paciente *extra = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        Paciente *trabalho = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        if (entrada == NULL || extra == NULL || trabalho == NULL) {
+            fprintf(stderr, "Memória insuficiente para n = %lld\n", n);
+            free(entrada);
+            free(extra);
+            free(trabalho);
+            return EXIT_FAILURE;
+        }
+
+        for (int d = 0; d < DIST_QUANTIDADE; d++) {
+            gerarPacientes(entrada, n, (Distribuicao) d, 12345u);
+            gerarPacientes(extra, n, (Distribuicao) d, 54321u);
+
+            for (int op = 0; op < OP_QUANTIDADE; op++) {
+                long long repeticoes = BENCH_OPS_ALVO / n > 0 ? BENCH_OPS_ALVO / n : 1;
+                long long totalOps = 0;
+                double inicio = benchAgoraNs();
+                nAmostras = 0;
+                for (long long r = 0; r < repeticoes; r++) {
+                    long long ops = executarRepeticao((OperacaoBench) op, entrada, extra, trabalho, (int) n);
+                    if (ops < 0) {
+                        fprintf(stderr, "Memória insuficiente para n = %lld\n", n);
+                        free(entrada);
+                        free(extra);
+                        free(trabalho);
+                        return EXIT_FAILURE;
+                    }
+                    totalOps += ops;
+                }
+                double nsTotal = benchAgoraNs() - inicio;
+
+                ResultadoBench r;
+                r.estrutura = "max_heap";
+                r.operacao = nomesOperacoes[op];
+                r.distribuicao = nomeDistribuicao((Distribuicao) d);
+                r.n = n;
+                r.operacoes = totalOps;
+                resumirAmostras(amostras, nAmostras, &r);
+                // Vazão de parede (inclui a preparação de cada repetição)
+                r.mopsPorSeg = nsTotal > 0.0 ? (double) totalOps * 1e3 / nsTotal : 0.0;
+                relatorioAdicionar(&r);
+            }
+        }
+        free(entrada);
+        free(extra);
+        free(trabalho);
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Imprime as opções de linha de comando.
+ */
+static void imprimirUso(const char *programa) {
+    printf("Uso: %s [opções]\n", programa);
+    printf("  --secao NOME     suite (padrão), crescimento, lote, dary, heapsort, radix,\n");
+    printf("                   concorrente, paralelo, estavel, baldes, minmax, envelhecimento, topk, fusao,\n");
+    printf("                   extrairlote, adiada, indireta, alocacao, instrumentacao, externa,\n");
+    printf("                   persistente, largaescala ou todas\n");
+    printf("  --min N          menor tamanho da suíte (padrão 1000)\n");
+    printf("  --max N          maior tamanho da suíte (padrão 1000000, até 100000000)\n");
+    printf("  --formato F      texto (padrão), csv ou json\n");
+    printf("  --saida ARQUIVO  grava o relatório da suíte em ARQUIVO\n");
+    printf("  --threads N      máximo de threads nas seções concorrentes (padrão: núcleos)\n");
+    printf("  --externa-mb N   tamanho do arquivo da seção externa em MB (padrão 256)\n");
+    printf("  --memoria-mb N   orçamento de memória da seção externa em MB (padrão 32)\n");
+    printf("  --dir CAMINHO    diretório dos arquivos das seções externa e persistente (padrão .)\n");
+    printf("  --larga-max N    maior heap da seção largaescala (padrão 67108864; bilhões exigem\n");
+    printf("                   -DHEAP_LARGA_ESCALA=ON e 8 bytes de memória por paciente)\n");
+}
+
+int main(int argc, char *argv[]) {
+    const char *secao = "suite";
+    const char *caminhoSaida = NULL;
+    long long nMin = 1000;
+    long long nMax = 1000000;
+    FormatoRelatorio formato = FORMATO_TEXTO;
+    long long externaMb = 256;
+    long long memoriaMb = 32;
+    const char *diretorioExterna = ".";
+    long long largaMax = 1LL << 26;
+#ifdef _WIN32
+    int maxThreads = 4;
+#else
+    int maxThreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+
+    for (int i = 1; i < argc; i++) {
+        int temValor = i + 1 < argc;
+        if (strcmp(argv[i], "--secao") == 0 && temValor) {
+            secao = argv[++i];
+        } else if (strcmp(argv[i], "--min") == 0 && temValor) {
+            nMin = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--max") == 0 && temValor) {
+            nMax = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--formato") == 0 && temValor) {
+            const char *f = argv[++i];
+            formato = strcmp(f, "csv") == 0 ? FORMATO_CSV
+                    : (strcmp(f, "json") == 0 ? FORMATO_JSON : FORMATO_TEXTO);
+        } else if (strcmp(argv[i], "--threads") == 0 && temValor) {
+            maxThreads = atoi(argv[++i]);
+        } else if (strcmp(argv[i], "--externa-mb") == 0 && temValor) {
+            externaMb = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--memoria-mb") == 0 && temValor) {
+            memoriaMb = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--dir") == 0 && temValor) {
+            diretorioExterna = argv[++i];
+        } else if (strcmp(argv[i], "--larga-max") == 0 && temValor) {
+            largaMax = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--saida") == 0 && temValor) {
+            caminhoSaida = argv[++i];
+        } else {
+            imprimirUso(argv[0]);
+            return strcmp(argv[i], "--ajuda") == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (maxThreads < 1) {
+        maxThreads = 1;
+    }
+    if (nMin < 1 || nMax < nMin || nMax > 100000000LL) {
+        fprintf(stderr, "Tamanhos inválidos: --min %lld --max %lld\n", nMin, nMax);
+        return EXIT_FAILURE;
+    }
+    if (externaMb < 1 || memoriaMb < 1) {
+        fprintf(stderr, "Tamanhos inválidos: --externa-mb %lld --memoria-mb %lld\n", externaMb, memoriaMb);
+        return EXIT_FAILURE;
+    }
+
+    int todas = strcmp(secao, "todas") == 0;
+    int status = EXIT_SUCCESS;
+
+    if (todas || strcmp(secao, "suite") == 0) {
+        FILE *saida = stdout;
+        if (caminhoSaida != NULL) {
+            saida = fopen(caminhoSaida, "w");
+            if (saida == NULL) {
+                perror("Falha ao abrir o arquivo de saída");
+                return EXIT_FAILURE;
+            }
+        }
+        relatorioIniciar(saida, formato);
+        status = executarSuite(nMin, nMax);
+        relatorioFinalizar();
+        if (saida != stdout) {
+            fclose(saida);
+        }
+        if (todas) printf("\n");
+    }
+    if (todas || strcmp(secao, "crescimento") == 0) benchCrescimento();
+    if (todas || strcmp(secao, "lote") == 0) {
+        benchLote(0);
+        benchLote(1);
+    }
+    if (todas || strcmp(secao, "dary") == 0) benchDary();
+    if (todas || strcmp(secao, "heapsort") == 0) benchHeapsort();
+    if (todas || strcmp(secao, "radix") == 0) benchRadix();
+#ifdef HEAP_TEM_FILA_CONCORRENTE
+    if (todas || strcmp(secao, "concorrente") == 0) benchConcorrente(maxThreads);
+#endif
+    if (todas || strcmp(secao, "paralelo") == 0) benchParalelo(maxThreads);
+    if (todas || strcmp(secao, "estavel") == 0) benchEstavel();
+    if (todas || strcmp(secao, "baldes") == 0) benchBaldes();
+    if (todas || strcmp(secao, "minmax") == 0) benchMinMax();
+    if (todas || strcmp(secao, "envelhecimento") == 0) benchEnvelhecimento();
+    if (todas || strcmp(secao, "topk") == 0) benchTopK();
+    if (todas || strcmp(secao, "fusao") == 0) benchFusao();
+    if (todas || strcmp(secao, "extrairlote") == 0) benchExtrairLote();
+    if (todas || strcmp(secao, "adiada") == 0) benchInsercaoAdiada();
+    if (todas || strcmp(secao, "indireta") == 0) benchIndireta();
+    if (todas || strcmp(secao, "alocacao") == 0) benchAlocacao();
+    if (todas || strcmp(secao, "instrumentacao") == 0) benchInstrumentacao();
+    if (todas || strcmp(secao, "externa") == 0) benchExterna(externaMb, memoriaMb, diretorioExterna);
+#ifdef HEAP_TEM_PERSISTENCIA
+    if (todas || strcmp(secao, "persistente") == 0) benchPersistente(diretorioExterna);
+#endif
+    if (todas || strcmp(secao, "largaescala") == 0) benchLargaEscala(largaMax);
+
+    free(amostras);
+    return status;
+}
@@ -0,0 +1,1814 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stddef.h>
+#ifdef HEAP_TEM_FILA_CONCORRENTE
+#include <pthread.h>
+#endif
+#ifdef HEAP_TEM_PERSISTENCIA
+#include <signal.h>   // Teste de queda da heap persistente
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#endif
+
+// Contadores para as variantes instrumentadas do motor genérico. HEAP_MOVER
+// precisa ser definido antes da primeira inclusão de heap_generico.h.
+static unsigned long long benchComparacoes;
+static unsigned long long benchMovimentos;
+#define HEAP_MOVER(destino, origem) (benchMovimentos++, (destino) = (origem))
+// A instância contada mede a extração em lote pela fronteira (benchExtrairLote)
+#define HEAP_COMPARACAO_CARA 1
+#include "heap_generico/heap_generico.h"
+#include "includes/paciente.h"
+#define PACIENTE_MAIOR_CONTADO(a, b) (benchComparacoes++, (a).prioridade > (b).prioridade)
+HEAP_GERAR_ARRAY(contado, Paciente, PACIENTE_MAIOR_CONTADO)
+HEAP_DEFINIR_TIPO(HeapContada, Paciente)
+HEAP_GERAR(contada, HeapContada, Paciente, PACIENTE_MAIOR_CONTADO)
+
+#include "max_heap/max_heap.h"
+#include "min_heap/min_heap.h"
+#include "heapsort/heapsort.h"
+#include "dary_heap/dary_heap.h"
+#include "heap_chegada/heap_chegada.h"
+#include "heap_estavel/heap_estavel.h"
+#include "fila_baldes/fila_baldes.h"
+#include "heap_min_max/heap_min_max.h"
+#include "fila_envelhecimento/fila_envelhecimento.h"
+#include "top_k/top_k.h"
+#ifdef HEAP_TEM_PERSISTENCIA
+#include "heap_persistente/heap_persistente.h"
+#endif
+#include "pairing_heap/pairing_heap.h"
+#include "heap_indireta/heap_indireta.h"
+#ifdef HEAP_TEM_FILA_CONCORRENTE
+#include "fila_concorrente/fila_concorrente.h"
+#endif
+#include "ordenacao_externa/ordenacao_externa.h"
+#include "bench_tempo.h"
+#include "bench_util.h"
+#include "bench_secoes.h"
+
+/**
+ * @brief Mede o custo amortizado de inserção: capacidade fixa pré-alocada
+ * versus heap expansível com crescimento geométrico a partir de 1 posição.
+ */
+void benchCrescimento(void) {
+    const int tamanhos[] = {1000, 10000, 100000, 1000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+
+    printf("--- Inserção: capacidade fixa vs expansível ---\n");
+    printf("%10s %16s %16s %10s\n", "n", "fixa (ns/op)", "expans. (ns/op)", "razão");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        unsigned int estado = 42;
+
+        MaxHeap *fixa = criarMaxHeap(n);
+        double inicio = benchAgoraNs();
+        for (int i = 0; i < n; i++) {
+            inserirPacienteMax(fixa, pacienteAleatorio(&estado, i));
+        }
+        double nsFixa = (benchAgoraNs() - inicio) / n;
+        liberarMaxHeap(fixa);
+
+        estado = 42;
+        MaxHeap *expansivel = criarMaxHeapExpansivel(1);
+        inicio = benchAgoraNs();
+        for (int i = 0; i < n; i++) {
+            inserirPacienteMax(expansivel, pacienteAleatorio(&estado, i));
+        }
+        double nsExpansivel = (benchAgoraNs() - inicio) / n;
+        liberarMaxHeap(expansivel);
+
+        printf("%10d %16.2f %16.2f %10.2f\n", n, nsFixa, nsExpansivel, nsExpansivel / nsFixa);
+    }
+    printf("\n");
+}
+
+/**
+ * @brief Compara k inserções individuais com inserirLoteMax para lotes de
+ * tamanho k = razão * n sobre uma heap já com n pacientes. Usado para escolher
+ * o limiar de reconstrução de Floyd (LIMIAR_RECONSTRUCAO_LOTE).
+ * @param crescente Se diferente de 0, o lote tem prioridades crescentes
+ * (pior caso do heapify-up); caso contrário, aleatórias.
+ */
+void benchLote(int crescente) {
+    const int n = 1000000;
+    const double razoes[] = {0.01, 0.03, 0.06, 0.125, 0.25, 0.5, 1.0, 2.0};
+    const int nRazoes = sizeof(razoes) / sizeof(razoes[0]);
+    unsigned int estado = 7;
+
+    Paciente *base = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+    Paciente *lote = (Paciente*) malloc((size_t) n * 2 * sizeof(Paciente));
+    if (base == NULL || lote == NULL) {
+        free(base);
+        free(lote);
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        base[i] = pacienteAleatorio(&estado, i);
+    }
+    for (int i = 0; i < 2 * n; i++) {
+        lote[i] = pacienteAleatorio(&estado, n + i);
+        if (crescente) {
+            lote[i].prioridade = 1000 + i;
+        }
+    }
+
+    printf("--- Inserção em lote sobre n=%d (prioridades %s) ---\n", n,
+           crescente ? "crescentes" : "aleatórias");
+    printf("%8s %10s %18s %18s\n", "k/n", "k", "individual (ms)", "inserirLote (ms)");
+    for (int r = 0; r < nRazoes; r++) {
+        int k = (int) (razoes[r] * n);
+
+        MaxHeap *heap = criarMaxHeapDeArray(base, n, 0);
+        reservarMaxHeap(heap, n + k);
+        double inicio = benchAgoraNs();
+        for (int i = 0; i < k; i++) {
+            inserirPacienteMax(heap, lote[i]);
+        }
+        double msIndividual = (benchAgoraNs() - inicio) / 1e6;
+        liberarMaxHeap(heap);
+
+        heap = criarMaxHeapDeArray(base, n, 0);
+        reservarMaxHeap(heap, n + k);
+        inicio = benchAgoraNs();
+        inserirLoteMax(heap, lote, k);
+        double msLote = (benchAgoraNs() - inicio) / 1e6;
+        liberarMaxHeap(heap);
+
+        printf("%8.3f %10d %18.2f %18.2f\n", razoes[r], k, msIndividual, msLote);
+    }
+    printf("\n");
+    free(base);
+    free(lote);
+}
+
+/**
+ * @brief Compara a Max-Heap binária com a Max-Heap d-ária (alinhada à linha
+ * de cache, escolha do maior filho vetorizada): n inserções seguidas de n
+ * extrações, para n de 10^4 a 10^7.
+ */
+void benchDary(void) {
+    const int tamanhos[] = {10000, 100000, 1000000, 10000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+
+    printf("--- Max-Heap binária vs %d-ária (ns/op) ---\n", DARY_ARIDADE);
+    printf("%10s %14s %14s %14s %14s\n", "n", "bin. inserir", "bin. extrair", "d-ária inserir", "d-ária extrair");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        unsigned int estado = 99;
+        long long soma = 0; // Evita que o compilador descarte as extrações
+
+        MaxHeap *binaria = criarMaxHeap(n);
+        double inicio = benchAgoraNs();
+        for (int i = 0; i < n; i++) {
+            inserirPacienteMax(binaria, pacienteAleatorio(&estado, i));
+        }
+        double nsBinIns = (benchAgoraNs() - inicio) / n;
+        inicio = benchAgoraNs();
+        while (!maxHeapVazia(binaria)) {
+            soma += extrairMaxPacienteHeap(binaria).prioridade;
+        }
+        double nsBinExt = (benchAgoraNs() - inicio) / n;
+        liberarMaxHeap(binaria);
+
+        estado = 99;
+        DaryHeap *dary = criarDaryHeap(n);
+        inicio = benchAgoraNs();
+        for (int i = 0; i < n; i++) {
+            inserirPacienteDary(dary, pacienteAleatorio(&estado, i));
+        }
+        double nsDaryIns = (benchAgoraNs() - inicio) / n;
+        inicio = benchAgoraNs();
+        while (!daryHeapVazia(dary)) {
+            soma -= extrairMaxPacienteDary(dary).prioridade;
+        }
+        double nsDaryExt = (benchAgoraNs() - inicio) / n;
+        liberarDaryHeap(dary);
+
+        printf("%10d %14.2f %14.2f %14.2f %14.2f%s\n", n, nsBinIns, nsBinExt, nsDaryIns, nsDaryExt,
+               soma != 0 ? "  (ERRO: extrações divergem)" : "");
+    }
+    printf("\n");
+}
+
+/**
+ * @brief Heapsort de referência com trocas e recursão (implementação anterior
+ * ao heapify por buraco), instrumentado: cada troca conta 3 movimentos.
+ */
+static void descerComTrocas(Paciente array[], int n, int i) {
+    int maior = i;
+    int esquerda = 2 * i + 1;
+    int direita = 2 * i + 2;
+    if (esquerda < n && PACIENTE_MAIOR_CONTADO(array[esquerda], array[maior])) {
+        maior = esquerda;
+    }
+    if (direita < n && PACIENTE_MAIOR_CONTADO(array[direita], array[maior])) {
+        maior = direita;
+    }
+    if (maior != i) {
+        trocarPacientes(&array[i], &array[maior]);
+        benchMovimentos += 3;
+        descerComTrocas(array, n, maior);
+    }
+}
+
+static void heapsortComTrocas(Paciente array[], int n) {
+    for (int i = n / 2 - 1; i >= 0; i--) {
+        descerComTrocas(array, n, i);
+    }
+    for (int i = n - 1; i > 0; i--) {
+        trocarPacientes(&array[0], &array[i]);
+        benchMovimentos += 3;
+        descerComTrocas(array, i, 0);
+    }
+}
+
+/**
+ * @brief Compara as variantes de heapsort: comparações e movimentos (contados
+ * em cópias instrumentadas do motor) e tempo de parede (biblioteca, sem contagem;
+ * a referência com trocas é sempre a versão instrumentada).
+ */
+void benchHeapsort(void) {
+    const int tamanhos[] = {10000, 100000, 1000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+
+    printf("--- Heapsort: trocas vs buraco clássico vs bottom-up ---\n");
+    printf("%10s %-12s %14s %14s %12s\n", "n", "variante", "comp./n", "movim./n", "tempo (ms)");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        unsigned int estado = 2024;
+        Paciente *original = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        Paciente *array = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        if (original == NULL || array == NULL) {
+            free(original);
+            free(array);
+            return;
+        }
+        for (int i = 0; i < n; i++) {
+            original[i] = pacienteAleatorio(&estado, i);
+        }
+
+        for (int variante = 0; variante < 3; variante++) {
+            const char *nome = variante == 0 ? "trocas" : (variante == 1 ? "classico" : "bottom-up");
+
+            memcpy(array, original, (size_t) n * sizeof(Paciente));
+            benchComparacoes = 0;
+            benchMovimentos = 0;
+            if (variante == 0) {
+                heapsortComTrocas(array, n);
+            } else if (variante == 1) {
+                contadoOrdenar(array, n);
+            } else {
+                contadoOrdenarBottomUp(array, n);
+            }
+            unsigned long long comparacoes = benchComparacoes;
+            unsigned long long movimentos = benchMovimentos;
+
+            memcpy(array, original, (size_t) n * sizeof(Paciente));
+            double inicio = benchAgoraNs();
+            if (variante == 0) {
+                heapsortComTrocas(array, n);
+            } else {
+                heapsortPacientesModo(array, n, variante == 1 ? HEAPSORT_CLASSICO : HEAPSORT_BOTTOM_UP);
+            }
+            double ms = (benchAgoraNs() - inicio) / 1e6;
+
+            printf("%10d %-12s %14.2f %14.2f %12.2f\n", n, nome,
+                   (double) comparacoes / n, (double) movimentos / n, ms);
+        }
+        free(original);
+        free(array);
+    }
+    printf("\n");
+}
+
+/**
+ * @brief ns por elemento da melhor de 3 rodadas de 'variante' (0: heapsort,
+ * 1: radix, 2: ordenarPacientes) sobre cópias de 'original', repetindo arrays
+ * pequenos até somar ~10^6 elementos por rodada. Retorna -1 se a saída não
+ * ficar ordenada.
+ */
+static double nsOrdenacao(const Paciente original[], Paciente array[], int n, int variante) {
+    int repeticoes = n >= 1000000 ? 1 : 1000000 / n;
+    double melhor = 0.0;
+    for (int rodada = 0; rodada < 3; rodada++) {
+        double total = 0.0;
+        for (int r = 0; r < repeticoes; r++) {
+            memcpy(array, original, (size_t) n * sizeof(Paciente));
+            double inicio = benchAgoraNs();
+            if (variante == 0) {
+                heapsortPacientes(array, n);
+            } else if (variante == 1) {
+                radixSortPacientes(array, n);
+            } else {
+                ordenarPacientes(array, n);
+            }
+            total += benchAgoraNs() - inicio;
+        }
+        double ns = total / ((double) repeticoes * n);
+        if (rodada == 0 || ns < melhor) melhor = ns;
+    }
+    for (int i = 1; i < n; i++) {
+        if (array[i - 1].prioridade > array[i].prioridade) return -1.0;
+    }
+    return melhor;
+}
+
+/**
+ * @brief Heapsort vs radix sort LSD vs ordenarPacientes (escolha automática)
+ * para n de 10^2 a 10^7 e faixas de prioridade de 8 níveis de triagem a 31 bits.
+ */
+void benchRadix(void) {
+    const int tamanhos[] = {100, 1000, 10000, 100000, 1000000, 10000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+    const unsigned int mascaras[] = {7u, 0u, 0xfffffu, 0x7fffffffu}; // 0: 0 a 999
+    const char *nomesFaixa[] = {"0..7", "0..999", "20 bits", "31 bits"};
+    const int maiorN = tamanhos[nTamanhos - 1];
+
+    Paciente *original = (Paciente*) malloc((size_t) maiorN * sizeof(Paciente));
+    Paciente *array = (Paciente*) malloc((size_t) maiorN * sizeof(Paciente));
+    if (original == NULL || array == NULL) {
+        free(original);
+        free(array);
+        return;
+    }
+    printf("--- Ordenação: heapsortPacientes vs radixSortPacientes vs ordenarPacientes (ns/elemento) ---\n");
+    printf("%10s %-9s %12s %12s %12s %8s\n", "n", "faixa", "heapsort", "radix", "ordenar", "razão");
+    for (int f = 0; f < 4; f++) {
+        for (int t = 0; t < nTamanhos; t++) {
+            int n = tamanhos[t];
+            unsigned int estado = 2024;
+            for (int i = 0; i < n; i++) {
+                original[i] = pacienteAleatorio(&estado, i);
+                if (mascaras[f] != 0) {
+                    estado = estado * 1103515245u + 12345u;
+                    original[i].prioridade = (int) ((estado >> 1) & mascaras[f]);
+                }
+            }
+            double heap = nsOrdenacao(original, array, n, 0);
+            double radix = nsOrdenacao(original, array, n, 1);
+            double ordenar = nsOrdenacao(original, array, n, 2);
+            if (heap < 0 || radix < 0 || ordenar < 0) {
+                printf("%10d %-9s saída fora de ordem\n", n, nomesFaixa[f]);
+                continue;
+            }
+            printf("%10d %-9s %12.1f %12.1f %12.1f %8.2f\n", n, nomesFaixa[f], heap, radix, ordenar,
+                   ordenar > 0.0 ? heap / ordenar : 0.0);
+        }
+    }
+    printf("\n");
+    free(original);
+    free(array);
+}
+
+#ifdef HEAP_TEM_FILA_CONCORRENTE
+
+// Fila de referência: uma única MaxHeap protegida por uma trava global
+typedef struct {
+    pthread_mutex_t trava;
+    pthread_cond_t naoVazia;
+    MaxHeap *heap;
+    int fechada;
+} FilaTravaGlobal;
+
+// Parâmetros de cada thread do teste de estresse concorrente
+typedef struct {
+    int usarMultiQueue;          // 1: FilaConcorrente; 0: FilaTravaGlobal
+    FilaConcorrente *multi;
+    FilaTravaGlobal *global;
+    int primeiroId;              // Produtores: ids [primeiroId, primeiroId + quantidade)
+    int quantidade;
+    unsigned char *vistos;       // Consumidores: vezes que cada id foi extraído
+    long long extraidos;         // Consumidores: total extraído pela thread
+} ArgsEstresse;
+
+/**
+ * @brief Produtor: insere 'quantidade' pacientes com ids únicos.
+ */
+static void* produtorEstresse(void *arg) {
+    ArgsEstresse *a = (ArgsEstresse*) arg;
+    unsigned int estado = (unsigned int) a->primeiroId + 1u;
+    for (int i = 0; i < a->quantidade; i++) {
+        Paciente p = pacienteAleatorio(&estado, a->primeiroId + i);
+        if (a->usarMultiQueue) {
+            inserirPacienteConcorrente(a->multi, p);
+        } else {
+            pthread_mutex_lock(&a->global->trava);
+            inserirPacienteMax(a->global->heap, p);
+            pthread_cond_signal(&a->global->naoVazia);
+            pthread_mutex_unlock(&a->global->trava);
+        }
+    }
+    return NULL;
+}
+
+/**
+ * @brief Consumidor: extrai (bloqueando) até a fila ser fechada e esvaziar,
+ * marcando cada id visto.
+ */
+static void* consumidorEstresse(void *arg) {
+    ArgsEstresse *a = (ArgsEstresse*) arg;
+    for (;;) {
+        Paciente p;
+        if (a->usarMultiQueue) {
+            p = extrairMaxConcorrente(a->multi);
+        } else {
+            pthread_mutex_lock(&a->global->trava);
+            while (maxHeapVazia(a->global->heap) && !a->global->fechada) {
+                pthread_cond_wait(&a->global->naoVazia, &a->global->trava);
+            }
+            p = extrairMaxPacienteHeap(a->global->heap);
+            pthread_mutex_unlock(&a->global->trava);
+        }
+        if (p.id == -1) {
+            return NULL;
+        }
+        __atomic_add_fetch(&a->vistos[p.id], 1, __ATOMIC_RELAXED);
+        a->extraidos++;
+    }
+}
+
+/**
+ * @brief Executa uma rodada com 'threads' produtores e 'threads' consumidores.
+ * @return Tempo em ms, ou -1 se algum paciente foi perdido ou duplicado.
+ */
+static double rodadaEstresse(int usarMultiQueue, int threads, int porProdutor) {
+    int total = threads * porProdutor;
+    unsigned char *vistos = (unsigned char*) calloc((size_t) total, 1);
+    ArgsEstresse *args = (ArgsEstresse*) calloc((size_t) threads * 2, sizeof(ArgsEstresse));
+    pthread_t *ids = (pthread_t*) malloc((size_t) threads * 2 * sizeof(pthread_t));
+    FilaConcorrente *multi = usarMultiQueue ? criarFilaConcorrente(threads * 4, 1024) : NULL;
+    FilaTravaGlobal global;
+    global.heap = usarMultiQueue ? NULL : criarMaxHeapExpansivel(1024);
+    global.fechada = 0;
+    pthread_mutex_init(&global.trava, NULL);
+    pthread_cond_init(&global.naoVazia, NULL);
+
+    double ms = -1.0;
+    if (vistos != NULL && args != NULL && ids != NULL && (multi != NULL || global.heap != NULL)) {
+        double inicio = benchAgoraNs();
+        for (int t = 0; t < threads * 2; t++) {
+            args[t].usarMultiQueue = usarMultiQueue;
+            args[t].multi = multi;
+            args[t].global = &global;
+            args[t].primeiroId = (t % threads) * porProdutor;
+            args[t].quantidade = porProdutor;
+            args[t].vistos = vistos;
+            pthread_create(&ids[t], NULL, t < threads ? produtorEstresse : consumidorEstresse, &args[t]);
+        }
+        for (int t = 0; t < threads; t++) {
+            pthread_join(ids[t], NULL);
+        }
+        if (usarMultiQueue) {
+            fecharFilaConcorrente(multi);
+        } else {
+            pthread_mutex_lock(&global.trava);
+            global.fechada = 1;
+            pthread_cond_broadcast(&global.naoVazia);
+            pthread_mutex_unlock(&global.trava);
+        }
+        for (int t = threads; t < threads * 2; t++) {
+            pthread_join(ids[t], NULL);
+        }
+        ms = (benchAgoraNs() - inicio) / 1e6;
+
+        // Verificação: cada paciente extraído exatamente uma vez
+        for (int i = 0; i < total; i++) {
+            if (vistos[i] != 1) {
+                ms = -1.0;
+                break;
+            }
+        }
+    }
+
+    liberarFilaConcorrente(multi);
+    liberarMaxHeap(global.heap);
+    pthread_mutex_destroy(&global.trava);
+    pthread_cond_destroy(&global.naoVazia);
+    free(vistos);
+    free(args);
+    free(ids);
+    return ms;
+}
+
+void benchConcorrente(int maxThreads) {
+    const int porProdutor = 200000;
+
+    printf("--- Fila concorrente: MultiQueue vs trava global (estresse + escala) ---\n");
+    printf("%8s %12s %16s %16s %10s\n", "threads", "pacientes", "global (Mops/s)", "multi (Mops/s)", "verificação");
+    // Potências de 2 até maxThreads, sempre incluindo o próprio maxThreads
+    for (int threads = 1; ; threads *= 2) {
+        if (threads > maxThreads) {
+            threads = maxThreads;
+        }
+        double msGlobal = rodadaEstresse(0, threads, porProdutor);
+        double msMulti = rodadaEstresse(1, threads, porProdutor);
+        // Cada paciente conta duas operações (inserção e extração)
+        double ops = 2.0 * threads * porProdutor;
+        printf("%8d %12d %16.2f %16.2f %10s\n", threads, threads * porProdutor,
+               msGlobal > 0 ? ops / (msGlobal * 1e3) : 0.0,
+               msMulti > 0 ? ops / (msMulti * 1e3) : 0.0,
+               msGlobal < 0 || msMulti < 0 ? "FALHOU" : "ok");
+        if (threads == maxThreads) break;
+    }
+    printf("\n");
+}
+
+#endif // HEAP_TEM_FILA_CONCORRENTE
+
+void benchParalelo(int maxThreads) {
+    const int n = 10000000;
+    Paciente *original = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+    Paciente *array = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+    if (original == NULL || array == NULL) {
+        free(original);
+        free(array);
+        return;
+    }
+    gerarPacientes(original, n, DIST_UNIFORME, 77u);
+
+    memcpy(array, original, (size_t) n * sizeof(Paciente));
+    double inicio = benchAgoraNs();
+    heapsortPacientes(array, n);
+    double msSequencial = (benchAgoraNs() - inicio) / 1e6;
+
+    printf("--- Ordenação paralela de n=%d (heapsort sequencial: %.1f ms) ---\n", n, msSequencial);
+    printf("%8s %12s %10s\n", "threads", "tempo (ms)", "speedup");
+    for (int threads = 1; ; threads *= 2) {
+        if (threads > maxThreads) {
+            threads = maxThreads;
+        }
+        memcpy(array, original, (size_t) n * sizeof(Paciente));
+        inicio = benchAgoraNs();
+        ordenarPacientesParalelo(array, n, threads);
+        double ms = (benchAgoraNs() - inicio) / 1e6;
+        printf("%8d %12.1f %10.2f\n", threads, ms, msSequencial / ms);
+        if (threads == maxThreads) break;
+    }
+    printf("\n");
+    free(original);
+    free(array);
+}
+
+/**
+ * @brief Conta pares consecutivos da saída com mesma prioridade fora da ordem
+ * de chegada (ids crescentes na chegada).
+ */
+static long long contarInversoesFifo(const Paciente saida[], int n) {
+    long long inversoes = 0;
+    for (int i = 1; i < n; i++) {
+        if (saida[i].prioridade == saida[i - 1].prioridade && saida[i].id < saida[i - 1].id) {
+            inversoes++;
+        }
+    }
+    return inversoes;
+}
+
+void benchEstavel(void) {
+    const int tamanhos[] = {10000, 100000, 1000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+
+    printf("--- Desempate FIFO (8 prioridades): instável vs dois campos vs chave de 64 bits ---\n");
+    printf("%10s %-14s %14s %14s %12s\n", "n", "variante", "inserir (ns)", "extr./ord. (ns)", "inversões");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        Paciente *entrada = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        Paciente *saida = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        if (entrada == NULL || saida == NULL) {
+            free(entrada);
+            free(saida);
+            return;
+        }
+        gerarPacientes(entrada, n, DIST_POUCAS, 99u);
+
+        for (int variante = 0; variante < 3; variante++) {
+            const char *nome = variante == 0 ? "maxheap" : (variante == 1 ? "chegada" : "estavel");
+            MaxHeap *instavel = variante == 0 ? criarMaxHeap(n) : NULL;
+            MaxHeapChegada *chegada = variante == 1 ? criarMaxHeapChegada(n) : NULL;
+            MaxHeapEstavel *estavel = variante == 2 ? criarMaxHeapEstavel(n) : NULL;
+
+            double inicio = benchAgoraNs();
+            for (int i = 0; i < n; i++) {
+                if (variante == 0) inserirPacienteMax(instavel, entrada[i]);
+                else if (variante == 1) inserirPacienteMaxChegada(chegada, entrada[i]);
+                else inserirPacienteMaxEstavel(estavel, entrada[i]);
+            }
+            double meio = benchAgoraNs();
+            for (int i = 0; i < n; i++) {
+                if (variante == 0) saida[i] = extrairMaxPacienteHeap(instavel);
+                else if (variante == 1) saida[i] = extrairMaxPacienteChegada(chegada);
+                else saida[i] = extrairMaxPacienteEstavel(estavel);
+            }
+            double fim = benchAgoraNs();
+
+            printf("%10d %-14s %14.1f %14.1f %12lld\n", n, nome, (meio - inicio) / n, (fim - meio) / n,
+                   contarInversoesFifo(saida, n));
+            liberarMaxHeap(instavel);
+            liberarMaxHeapChegada(chegada);
+            liberarMaxHeapEstavel(estavel);
+        }
+
+        // Heapsort instável vs estável (saída crescente: a ordem de chegada
+        // dentro de cada prioridade também deve ser crescente)
+        for (int variante = 0; variante < 2; variante++) {
+            memcpy(saida, entrada, (size_t) n * sizeof(Paciente));
+            double inicio = benchAgoraNs();
+            if (variante == 0) {
+                heapsortPacientesModo(saida, n, HEAPSORT_BOTTOM_UP);
+            } else {
+                heapsortPacientesEstavel(saida, n);
+            }
+            double ns = (benchAgoraNs() - inicio) / n;
+            printf("%10d %-14s %14s %14.1f %12lld\n", n, variante == 0 ? "heapsort" : "heapsort-est.", "-", ns,
+                   contarInversoesFifo(saida, n));
+        }
+        free(entrada);
+        free(saida);
+    }
+    printf("\n");
+}
+
+// Distribuições de prioridade da seção de baldes
+typedef enum {
+    TRIAGEM_ESCALA,  // Escala de 0 a 999 uniforme
+    TRIAGEM_NIVEIS,  // 8 níveis uniformes
+    TRIAGEM_CLINICA, // 5 níveis com pesos típicos de triagem (poucos urgentes)
+    TRIAGEM_QUANTIDADE
+} DistribuicaoTriagem;
+
+static Paciente pacienteTriagem(unsigned int *estado, int id, DistribuicaoTriagem dist) {
+    Paciente p = pacienteAleatorio(estado, id);
+    if (dist == TRIAGEM_NIVEIS) {
+        p.prioridade %= 8;
+    } else if (dist == TRIAGEM_CLINICA) {
+        // Em milésimos: 1% emergência, 10% muito urgente, 35% urgente,
+        // 40% pouco urgente e 14% não urgente
+        int sorteio = p.prioridade;
+        p.prioridade = sorteio < 10 ? 4 : (sorteio < 110 ? 3 : (sorteio < 460 ? 2 : (sorteio < 860 ? 1 : 0)));
+    }
+    return p;
+}
+
+void benchBaldes(void) {
+    const int tamanhos[] = {1000, 100000, 1000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+    const char *nomes[TRIAGEM_QUANTIDADE] = {"escala-1000", "8-niveis", "triagem-5"};
+
+    printf("--- MaxHeap vs FilaBaldes (ns por par extrair+inserir com n pacientes na fila) ---\n");
+    printf("%10s %-12s %14s %14s %10s\n", "n", "distribuicao", "maxheap", "baldes", "razão");
+    for (int d = 0; d < TRIAGEM_QUANTIDADE; d++) {
+        for (int t = 0; t < nTamanhos; t++) {
+            int n = tamanhos[t];
+            int operacoes = n > 200000 ? n : 200000;
+            double ns[2];
+            for (int variante = 0; variante < 2; variante++) {
+                unsigned int estado = 7;
+                MaxHeap *heap = variante == 0 ? criarMaxHeap(n + 1) : NULL;
+                FilaBaldes *fila = variante == 1 ? criarFilaBaldes(0, 999) : NULL;
+                for (int i = 0; i < n; i++) {
+                    Paciente p = pacienteTriagem(&estado, i, (DistribuicaoTriagem) d);
+                    if (variante == 0) inserirPacienteMax(heap, p);
+                    else inserirPacienteBaldes(fila, p);
+                }
+                long long verificacao = 0;
+                double inicio = benchAgoraNs();
+                for (int i = 0; i < operacoes; i++) {
+                    Paciente p = pacienteTriagem(&estado, n + i, (DistribuicaoTriagem) d);
+                    verificacao += variante == 0 ? extrairMaxPacienteHeap(heap).prioridade
+                                                 : extrairMaxPacienteBaldes(fila).prioridade;
+                    if (variante == 0) inserirPacienteMax(heap, p);
+                    else inserirPacienteBaldes(fila, p);
+                }
+                ns[variante] = (benchAgoraNs() - inicio) / operacoes;
+                if (verificacao < 0) printf("?"); // Impede que o laço seja descartado
+                liberarMaxHeap(heap);
+                liberarFilaBaldes(fila);
+            }
+            printf("%10d %-12s %14.1f %14.1f %10.2f\n", n, nomes[d], ns[0], ns[1], ns[0] / ns[1]);
+        }
+    }
+    printf("\n");
+}
+
+// Fila dupla de referência: os mesmos pacientes em uma MaxHeap e uma MinHeap,
+// com remoção preguiçosa (o id marcado como atendido é descartado ao aparecer
+// na raiz da outra heap)
+typedef struct {
+    MaxHeap *maior;
+    MinHeap *menor;
+    unsigned char *removido; // Indexado pelo id do paciente
+} FilaDupla;
+
+static Paciente extrairFilaDupla(FilaDupla *f, int doMaior) {
+    for (;;) {
+        Paciente p = doMaior ? extrairMaxPacienteHeap(f->maior) : extrairMinPacienteHeap(f->menor);
+        if (p.id < 0 || !f->removido[p.id]) {
+            if (p.id >= 0) f->removido[p.id] = 1;
+            return p;
+        }
+    }
+}
+
+void benchMinMax(void) {
+    const int tamanhos[] = {1000, 100000, 1000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+
+    printf("--- Fila dupla: MaxHeap + MinHeap com remoção preguiçosa vs HeapMinMax ---\n");
+    printf("%10s %14s %14s %10s %14s %14s\n", "n", "dupla (ns/op)", "minmax (ns/op)", "razão", "dupla (B/pac)",
+           "minmax (B/pac)");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        int rodadas = n > 200000 ? n : 200000; // Cada rodada: inserir, extrairMax, inserir, extrairMin
+        int totalIds = n + 2 * rodadas;
+        double ns[2];
+        double bytes[2];
+        long long verificacao[2];
+        for (int variante = 0; variante < 2; variante++) {
+            unsigned int estado = 31;
+            FilaDupla dupla = {NULL, NULL, NULL};
+            HeapMinMax *minMax = NULL;
+            if (variante == 0) {
+                dupla.maior = criarMaxHeapExpansivel(0);
+                dupla.menor = criarMinHeapExpansivel(0);
+                dupla.removido = (unsigned char*) calloc((size_t) totalIds, 1);
+                if (!dupla.maior || !dupla.menor || !dupla.removido) {
+                    liberarMaxHeap(dupla.maior);
+                    liberarMinHeap(dupla.menor);
+                    free(dupla.removido);
+                    return;
+                }
+            } else {
+                minMax = criarHeapMinMaxExpansivel(0);
+                if (minMax == NULL) return;
+            }
+            int id = 0;
+            for (; id < n; id++) {
+                Paciente p = pacienteAleatorio(&estado, id);
+                if (variante == 0) {
+                    inserirPacienteMax(dupla.maior, p);
+                    inserirPacienteMin(dupla.menor, p);
+                } else {
+                    inserirPacienteMinMax(minMax, p);
+                }
+            }
+            verificacao[variante] = 0;
+            double inicio = benchAgoraNs();
+            for (int r = 0; r < rodadas; r++) {
+                for (int lado = 1; lado >= 0; lado--) {
+                    Paciente p = pacienteAleatorio(&estado, id++);
+                    Paciente saiu;
+                    if (variante == 0) {
+                        inserirPacienteMax(dupla.maior, p);
+                        inserirPacienteMin(dupla.menor, p);
+                        saiu = extrairFilaDupla(&dupla, lado);
+                    } else {
+                        inserirPacienteMinMax(minMax, p);
+                        saiu = lado ? extrairMaxPacienteMinMax(minMax) : extrairMinPacienteMinMax(minMax);
+                    }
+                    verificacao[variante] += (long long) saiu.prioridade * (lado ? 1 : -1);
+                }
+            }
+            ns[variante] = (benchAgoraNs() - inicio) / (4.0 * rodadas);
+            if (variante == 0) {
+                // Só os arrays: entradas já atendidas continuam ocupando a outra heap
+                bytes[0] = (double) (dupla.maior->capacidade + dupla.menor->capacidade) * sizeof(Paciente) / n;
+                liberarMaxHeap(dupla.maior);
+                liberarMinHeap(dupla.menor);
+                free(dupla.removido);
+            } else {
+                bytes[1] = (double) minMax->capacidade * sizeof(Paciente) / n;
+                liberarHeapMinMax(minMax);
+            }
+        }
+        printf("%10d %14.1f %14.1f %10.2f %14.1f %14.1f%s\n", n, ns[0], ns[1], ns[0] / ns[1], bytes[0], bytes[1],
+               verificacao[0] == verificacao[1] ? "" : "  (FALHOU: extrações diferentes)");
+    }
+    printf("\n");
+}
+
+void benchEnvelhecimento(void) {
+    const int tamanhos[] = {10000, 100000, 1000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+    const int tiques = 60;
+    // 1 ponto por tique de espera, com teto de 30 pontos
+    const SegmentoEnvelhecimento curva[] = {{0, 1}, {30, 0}};
+
+    printf("--- Envelhecimento: reescrever prioridades + Floyd a cada tique vs FilaEnvelhecimento ---\n");
+    printf("%10s %16s %16s %16s %16s\n", "n", "rebuild (ms)", "envelh. (ms)", "pior tique reb.",
+           "pior tique env.");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        int porTique = n / 100; // Chegadas e atendimentos por tique
+        int totalIds = n + tiques * porTique;
+        int *baseDe = (int*) malloc((size_t) totalIds * sizeof(int));
+        long long *chegadaDe = (long long*) malloc((size_t) totalIds * sizeof(long long));
+        MaxHeap *heap = criarMaxHeap(n + porTique);
+        FilaEnvelhecimento *fila = criarFilaEnvelhecimento(curva, 2);
+        if (!baseDe || !chegadaDe || !heap || !fila) {
+            free(baseDe);
+            free(chegadaDe);
+            liberarMaxHeap(heap);
+            liberarFilaEnvelhecimento(fila);
+            return;
+        }
+        // Bases distintas e espaçadas de 32 (> teto) para que não haja empates de
+        // prioridade efetiva e as duas variantes atendam exatamente os mesmos pacientes
+        unsigned int estado = 37;
+        for (int id = 0; id < totalIds; id++) {
+            baseDe[id] = id * 32;
+        }
+        for (int id = totalIds - 1; id > 0; id--) {
+            estado = estado * 1103515245u + 12345u;
+            int j = (int) ((estado >> 8) % (unsigned int) (id + 1));
+            int tmp = baseDe[id];
+            baseDe[id] = baseDe[j];
+            baseDe[j] = tmp;
+        }
+
+        double totalNs[2] = {0, 0};
+        double piorNs[2] = {0, 0};
+        long long soma[2] = {0, 0};
+        for (int variante = 0; variante < 2; variante++) {
+            int id = 0;
+            for (; id < n; id++) {
+                chegadaDe[id] = 0;
+                if (variante == 0) inserirPacienteMax(heap, (Paciente){id, baseDe[id]});
+                else inserirPacienteEnvelhecimento(fila, (Paciente){id, baseDe[id]});
+            }
+            for (long long agora = 1; agora <= tiques; agora++) {
+                double inicio = benchAgoraNs();
+                if (variante == 0) {
+                    // Abordagem atual: reescreve todas as prioridades e reconstrói
+                    for (int i = 0; i < heap->tamanho; i++) {
+                        int pid = heap->array[i].id;
+                        heap->array[i].prioridade = (int) prioridadeEfetivaEnvelhecimento(fila, baseDe[pid],
+                                                                                          agora - chegadaDe[pid]);
+                    }
+                    for (int i = heap->tamanho / 2 - 1; i >= 0; i--) {
+                        heapifyDownMaxArray(heap->array, heap->tamanho, i);
+                    }
+                } else {
+                    avancarRelogioEnvelhecimento(fila, agora);
+                }
+                for (int k = 0; k < porTique; k++) {
+                    long long efetiva;
+                    if (variante == 0) {
+                        efetiva = extrairMaxPacienteHeap(heap).prioridade;
+                    } else {
+                        extrairMaxPacienteEnvelhecimento(fila, &efetiva);
+                    }
+                    soma[variante] += efetiva;
+                    chegadaDe[id] = agora;
+                    if (variante == 0) inserirPacienteMax(heap, (Paciente){id, baseDe[id]});
+                    else inserirPacienteEnvelhecimento(fila, (Paciente){id, baseDe[id]});
+                    id++;
+                }
+                double ns = benchAgoraNs() - inicio;
+                totalNs[variante] += ns;
+                if (ns > piorNs[variante]) piorNs[variante] = ns;
+            }
+        }
+        printf("%10d %16.2f %16.2f %16.3f %16.3f%s\n", n, totalNs[0] / 1e6, totalNs[1] / 1e6, piorNs[0] / 1e6,
+               piorNs[1] / 1e6, soma[0] == soma[1] ? "" : "  (FALHOU: prioridades efetivas diferentes)");
+        free(baseDe);
+        free(chegadaDe);
+        liberarMaxHeap(heap);
+        liberarFilaEnvelhecimento(fila);
+    }
+    printf("(%d tiques, n/100 chegadas e atendimentos por tique; pior tique em ms)\n\n", tiques);
+}
+
+void benchTopK(void) {
+    const int tamanhos[] = {1000000, 10000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+    const int ks[] = {10, 50, 1000, 100000};
+    const int nKs = sizeof(ks) / sizeof(ks[0]);
+
+    printf("--- Top-k: heapsort completo vs topKPacientes vs acumulador vs ordenação parcial (ms) ---\n");
+    printf("%10s %8s %12s %12s %12s %12s %8s\n", "n", "k", "heapsort", "topK", "acumulador", "parcial", "confere");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        Paciente *entrada = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        Paciente *trabalho = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        Paciente *saida = (Paciente*) malloc((size_t) ks[nKs - 1] * sizeof(Paciente));
+        if (entrada == NULL || trabalho == NULL || saida == NULL) {
+            free(entrada);
+            free(trabalho);
+            free(saida);
+            return;
+        }
+        gerarPacientes(entrada, n, DIST_UNIFORME, 13u);
+
+        // Referência: ordenação completa (ascendente; os k melhores ficam no fim)
+        memcpy(trabalho, entrada, (size_t) n * sizeof(Paciente));
+        double inicio = benchAgoraNs();
+        heapsortPacientesModo(trabalho, n, HEAPSORT_BOTTOM_UP);
+        double msHeapsort = (benchAgoraNs() - inicio) / 1e6;
+        long long somaReferencia[sizeof(ks) / sizeof(ks[0])];
+        for (int j = 0; j < nKs; j++) {
+            somaReferencia[j] = 0;
+            for (int i = 0; i < ks[j]; i++) somaReferencia[j] += trabalho[n - 1 - i].prioridade;
+        }
+
+        for (int j = 0; j < nKs; j++) {
+            int k = ks[j];
+            int confere = 1;
+            long long soma;
+
+            inicio = benchAgoraNs();
+            int m = topKPacientes(entrada, n, k, saida);
+            double msTopK = (benchAgoraNs() - inicio) / 1e6;
+            soma = 0;
+            for (int i = 0; i < m; i++) soma += saida[i].prioridade;
+            confere &= soma == somaReferencia[j];
+
+            AcumuladorTopK *acumulador = criarAcumuladorTopK(k);
+            inicio = benchAgoraNs();
+            for (int i = 0; i < n; i++) {
+                adicionarPacienteTopK(acumulador, entrada[i]);
+            }
+            m = consultarTopK(acumulador, saida);
+            double msAcumulador = (benchAgoraNs() - inicio) / 1e6;
+            liberarAcumuladorTopK(acumulador);
+            soma = 0;
+            for (int i = 0; i < m; i++) soma += saida[i].prioridade;
+            confere &= soma == somaReferencia[j];
+
+            memcpy(trabalho, entrada, (size_t) n * sizeof(Paciente));
+            inicio = benchAgoraNs();
+            ordenarParcialPacientes(trabalho, n, k);
+            double msParcial = (benchAgoraNs() - inicio) / 1e6;
+            soma = 0;
+            for (int i = 0; i < k; i++) soma += trabalho[i].prioridade;
+            confere &= soma == somaReferencia[j];
+
+            printf("%10d %8d %12.1f %12.1f %12.1f %12.1f %8s\n", n, k, msHeapsort, msTopK, msAcumulador,
+                   msParcial, confere ? "ok" : "FALHOU");
+        }
+        free(entrada);
+        free(trabalho);
+        free(saida);
+    }
+    printf("\n");
+}
+
+void benchFusao(void) {
+    const int tamanhos[] = {10000, 100000, 1000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+
+    printf("--- Fusão de duas filas com n pacientes cada ---\n");
+    printf("%10s %14s %14s %14s %12s %12s %12s %12s\n", "n", "ingenua (ms)", "Floyd (ms)", "pairing (us)",
+           "ins. heap", "ins. pairing", "ext. heap", "ext. pairing");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        Paciente *pacientes = (Paciente*) malloc((size_t) 2 * n * sizeof(Paciente));
+        if (pacientes == NULL) {
+            return;
+        }
+        gerarPacientes(pacientes, 2LL * n, DIST_UNIFORME, 23u);
+
+        // Ingênua: extrai cada paciente de uma MaxHeap e insere na outra
+        MaxHeap *a = criarMaxHeapExpansivel(n);
+        MaxHeap *b = criarMaxHeapExpansivel(n);
+        inserirLoteMax(a, pacientes, n);
+        inserirLoteMax(b, pacientes + n, n);
+        double inicio = benchAgoraNs();
+        while (!maxHeapVazia(b)) {
+            inserirPacienteMax(a, extrairMaxPacienteHeap(b));
+        }
+        double msIngenua = (benchAgoraNs() - inicio) / 1e6;
+        liberarMaxHeap(a);
+        liberarMaxHeap(b);
+
+        // Concatenação + Floyd (heaps montadas por inserção para medir o custo por paciente)
+        a = criarMaxHeapExpansivel(0);
+        b = criarMaxHeapExpansivel(0);
+        inicio = benchAgoraNs();
+        for (int i = 0; i < n; i++) {
+            inserirPacienteMax(a, pacientes[i]);
+            inserirPacienteMax(b, pacientes[n + i]);
+        }
+        double nsInserirHeap = (benchAgoraNs() - inicio) / (2.0 * n);
+        inicio = benchAgoraNs();
+        fundirMaxHeaps(a, b);
+        double msFloyd = (benchAgoraNs() - inicio) / 1e6;
+        long long somaHeap = 0;
+        inicio = benchAgoraNs();
+        while (!maxHeapVazia(a)) {
+            somaHeap += extrairMaxPacienteHeap(a).prioridade;
+        }
+        double nsExtrairHeap = (benchAgoraNs() - inicio) / (2.0 * n);
+        liberarMaxHeap(a);
+        liberarMaxHeap(b);
+
+        // Pairing heap: fusão em O(1)
+        PairingHeap *pa = criarPairingHeap();
+        PairingHeap *pb = criarPairingHeap();
+        inicio = benchAgoraNs();
+        for (int i = 0; i < n; i++) {
+            inserirPacientePairing(pa, pacientes[i]);
+            inserirPacientePairing(pb, pacientes[n + i]);
+        }
+        double nsInserirPairing = (benchAgoraNs() - inicio) / (2.0 * n);
+        inicio = benchAgoraNs();
+        fundirPairingHeaps(pa, pb);
+        double usPairing = (benchAgoraNs() - inicio) / 1e3;
+        long long somaPairing = 0;
+        inicio = benchAgoraNs();
+        while (!pairingHeapVazia(pa)) {
+            somaPairing += extrairMaxPacientePairing(pa).prioridade;
+        }
+        double nsExtrairPairing = (benchAgoraNs() - inicio) / (2.0 * n);
+        liberarPairingHeap(pa);
+        liberarPairingHeap(pb);
+
+        printf("%10d %14.2f %14.2f %14.2f %12.1f %12.1f %12.1f %12.1f%s\n", n, msIngenua, msFloyd, usPairing,
+               nsInserirHeap, nsInserirPairing, nsExtrairHeap, nsExtrairPairing,
+               somaHeap == somaPairing ? "" : "  (FALHOU: conteúdos diferentes)");
+        free(pacientes);
+    }
+    printf("(ins./ext.: ns por paciente)\n\n");
+}
+
+/**
+ * @brief Comparações por paciente para extrair k de uma heap com os n
+ * pacientes dados, em k extrações individuais (lote = 0) ou pela fronteira
+ * (contadaExtrairLote, com HEAP_COMPARACAO_CARA).
+ */
+static double comparacoesExtracao(const Paciente pacientes[], int n, int k, Paciente saida[], int lote) {
+    HeapContada heap;
+    if (contadaInicializar(&heap, n, 0) != HEAP_OK) return 0.0;
+    memcpy(heap.array, pacientes, (size_t) n * sizeof(Paciente));
+    heap.tamanho = n;
+    contadaConstruir(heap.array, n);
+    benchComparacoes = 0;
+    if (lote) {
+        contadaExtrairLote(&heap, k, saida);
+    } else {
+        for (int j = 0; j < k; j++) {
+            contadaExtrair(&heap, &saida[j]);
+        }
+    }
+    free(heap.array);
+    return (double) benchComparacoes / k;
+}
+
+void benchExtrairLote(void) {
+    const int tamanhos[] = {1000, 100000, 1000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+    const int lotes[] = {20, 50, 1000, 0}; // 0 = n/4
+    const int nLotes = sizeof(lotes) / sizeof(lotes[0]);
+
+    printf("--- Extração dos k mais urgentes: k x extrairMaxPacienteHeap vs extrairLoteMax ---\n");
+    printf("%10s %8s %14s %14s %8s %14s %16s\n", "n", "k", "laço (ns/pac)", "lote (ns/pac)", "razão",
+           "laço (comp)", "fronteira (comp)");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        Paciente *pacientes = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        Paciente *saida = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        if (pacientes == NULL || saida == NULL) {
+            free(pacientes);
+            free(saida);
+            return;
+        }
+        gerarPacientes(pacientes, n, DIST_UNIFORME, 41);
+        for (int l = 0; l < nLotes; l++) {
+            int k = lotes[l] > 0 ? lotes[l] : n / 4;
+            if (k > n) continue;
+            int rodadas = (int) (2000000LL / k) + 1;
+            if (rodadas > 20000) rodadas = 20000;
+            double ns[2];
+            long long verificacao[2];
+            for (int variante = 0; variante < 2; variante++) {
+                MaxHeap *heap = criarMaxHeapDeArray(pacientes, n, 0);
+                if (heap == NULL) {
+                    free(pacientes);
+                    free(saida);
+                    return;
+                }
+                verificacao[variante] = 0;
+                double total = 0.0;
+                for (int r = 0; r < rodadas; r++) {
+                    double inicio = benchAgoraNs();
+                    if (variante == 0) {
+                        for (int j = 0; j < k; j++) {
+                            saida[j] = extrairMaxPacienteHeap(heap);
+                        }
+                    } else {
+                        extrairLoteMax(heap, k, saida);
+                    }
+                    total += benchAgoraNs() - inicio;
+                    for (int j = 0; j < k; j++) {
+                        verificacao[variante] += (long long) saida[j].prioridade * (j + 1);
+                        // Volta com outra prioridade para a heap não se esgotar do topo
+                        saida[j].prioridade = (saida[j].prioridade * 7 + r) % 1000;
+                    }
+                    inserirLoteMax(heap, saida, k);
+                }
+                ns[variante] = total / ((double) rodadas * k);
+                liberarMaxHeap(heap);
+            }
+            printf("%10d %8d %14.1f %14.1f %8.2f %14.1f %16.1f%s\n", n, k, ns[0], ns[1], ns[0] / ns[1],
+                   comparacoesExtracao(pacientes, n, k, saida, 0), comparacoesExtracao(pacientes, n, k, saida, 1),
+                   verificacao[0] == verificacao[1] ? "" : "  (FALHOU: prioridades diferentes)");
+        }
+        free(pacientes);
+        free(saida);
+    }
+    printf("\n");
+}
+
+/**
+ * @brief ns por paciente de 'rodadas' rajadas de k inserções seguidas de uma
+ * espiada e k extrações sobre uma MaxHeap com os n pacientes dados, com
+ * inserção imediata ou adiada. Acumula em *verificacao as prioridades extraídas.
+ */
+static double nsRajadas(const Paciente base[], int n, int k, int rodadas, int crescentes,
+                        int adiada, long long *verificacao) {
+    MaxHeap *heap = criarMaxHeapDeArray((Paciente*) base, n, 0);
+    if (heap == NULL || reservarMaxHeap(heap, n + k) != HEAP_OK) {
+        liberarMaxHeap(heap);
+        return 0.0;
+    }
+    definirInsercaoAdiadaMaxHeap(heap, adiada);
+    unsigned int estado = 97;
+    *verificacao = 0;
+    double inicio = benchAgoraNs();
+    for (int r = 0; r < rodadas; r++) {
+        for (int j = 0; j < k; j++) {
+            Paciente p = pacienteAleatorio(&estado, n + j);
+            if (crescentes) {
+                p.prioridade = 1000 + r * k + j; // Cada chegada mais urgente que as anteriores
+            }
+            inserirPacienteMax(heap, p);
+        }
+        *verificacao += espiarMaxPacienteHeap(heap).prioridade;
+        for (int j = 0; j < k; j++) {
+            *verificacao += extrairMaxPacienteHeap(heap).prioridade;
+        }
+    }
+    double ns = (benchAgoraNs() - inicio) / ((double) rodadas * k);
+    liberarMaxHeap(heap);
+    return ns;
+}
+
+void benchInsercaoAdiada(void) {
+    const int tamanhos[] = {100000, 1000000};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+    const int rajadas[] = {1, 16, 256, 4096, 0, 0}; // 0 = n/8 e n/2
+    const int nRajadas = sizeof(rajadas) / sizeof(rajadas[0]);
+
+    printf("--- Rajadas de k chegadas entre k extrações: inserção imediata vs adiada ---\n");
+    printf("%10s %8s %12s %14s %14s %8s\n", "n", "k", "prioridades", "imediata (ns)", "adiada (ns)", "razão");
+    for (int t = 0; t < nTamanhos; t++) {
+        int n = tamanhos[t];
+        Paciente *base = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+        if (base == NULL) return;
+        gerarPacientes(base, n, DIST_UNIFORME, 43);
+        for (int crescentes = 0; crescentes < 2; crescentes++) {
+            for (int r = 0; r < nRajadas; r++) {
+                int k = rajadas[r] > 0 ? rajadas[r] : (r == nRajadas - 2 ? n / 8 : n / 2);
+                int rodadas = (int) (2000000LL / k) + 1;
+                if (rodadas > 200000) rodadas = 200000;
+                long long verificacao[2];
+                double imediata = nsRajadas(base, n, k, rodadas, crescentes, 0, &verificacao[0]);
+                double adiada = nsRajadas(base, n, k, rodadas, crescentes, 1, &verificacao[1]);
+                printf("%10d %8d %12s %14.1f %14.1f %8.2f%s\n", n, k, crescentes ? "crescentes" : "aleatórias",
+                       imediata, adiada, adiada > 0.0 ? imediata / adiada : 0.0,
+                       verificacao[0] == verificacao[1] ? "" : "  (FALHOU: prioridades diferentes)");
+            }
+        }
+        free(base);
+    }
+    printf("(ns por paciente: inserção + extração)\n\n");
+}
+
+// Registros de tamanho fixo para benchIndireta: a MaxHeap direta de cada
+// tamanho é uma instância do motor sem contagem de movimentos, como a MaxHeap
+// da biblioteca.
+#undef HEAP_MOVER
+#define HEAP_MOVER(destino, origem) ((destino) = (origem))
+#define BENCH_REGISTRO(bytes)                                                          \
+typedef struct {                                                                       \
+    int prioridade;                                                                    \
+    int id;                                                                            \
+    char dados[(bytes) - 2 * sizeof(int)];                                             \
+} Registro##bytes;                                                                     \
+HEAP_DEFINIR_TIPO(HeapRegistro##bytes, Registro##bytes)                                \
+HEAP_GERAR(heapRegistro##bytes, HeapRegistro##bytes, Registro##bytes, PACIENTE_MAIOR)  \
+                                                                                       \
+/* Mede as quatro colunas de benchIndireta para registros de 'bytes' bytes */          \
+static void medirRegistros##bytes(int n, double ns[4], long long verificacao[4]) {     \
+    Registro##bytes *registros = (Registro##bytes*) calloc((size_t) n, sizeof(Registro##bytes)); \
+    Registro##bytes *copia = (Registro##bytes*) malloc((size_t) n * sizeof(Registro##bytes)); \
+    uint32_t *permutacao = (uint32_t*) malloc((size_t) n * sizeof(uint32_t));          \
+    HeapRegistro##bytes direta;                                                        \
+    HeapIndireta *indireta = criarHeapIndireta(sizeof(Registro##bytes));               \
+    if (registros == NULL || copia == NULL || permutacao == NULL || indireta == NULL   \
+        || heapRegistro##bytes##Inicializar(&direta, n, 0) != HEAP_OK) {               \
+        free(registros);                                                               \
+        free(copia);                                                                   \
+        free(permutacao);                                                              \
+        liberarHeapIndireta(indireta);                                                 \
+        for (int c = 0; c < 4; c++) ns[c] = 0.0;                                       \
+        return;                                                                        \
+    }                                                                                  \
+    unsigned int estado = 53;                                                          \
+    for (int i = 0; i < n; i++) {                                                      \
+        Paciente p = pacienteAleatorio(&estado, i);                                    \
+        registros[i].prioridade = p.prioridade;                                        \
+        registros[i].id = p.id;                                                        \
+    }                                                                                  \
+    for (int c = 0; c < 4; c++) verificacao[c] = 0;                                    \
+    double inicio = benchAgoraNs();                                                    \
+    for (int i = 0; i < n; i++) {                                                      \
+        heapRegistro##bytes##Inserir(&direta, registros[i]);                           \
+    }                                                                                  \
+    Registro##bytes saida;                                                             \
+    for (int i = 0; i < n && heapRegistro##bytes##Extrair(&direta, &saida); i++) {     \
+        verificacao[0] += (long long) saida.prioridade * (i + 1) + saida.id;           \
+    }                                                                                  \
+    ns[0] = (benchAgoraNs() - inicio) / n;                                             \
+    inicio = benchAgoraNs();                                                           \
+    for (int i = 0; i < n; i++) {                                                      \
+        inserirHeapIndireta(indireta, registros[i].prioridade, &registros[i], NULL);   \
+    }                                                                                  \
+    for (int i = 0; i < n; i++) {                                                      \
+        int prioridade;                                                                \
+        RefRegistro ref = extrairMaxHeapIndireta(indireta, &prioridade);               \
+        const Registro##bytes *r = (const Registro##bytes*) registroHeapIndireta(indireta, ref); \
+        verificacao[1] += (long long) prioridade * (i + 1) + r->id;                    \
+        liberarRegistroHeapIndireta(indireta, ref);                                    \
+    }                                                                                  \
+    ns[1] = (benchAgoraNs() - inicio) / n;                                             \
+    memcpy(copia, registros, (size_t) n * sizeof(Registro##bytes));                    \
+    inicio = benchAgoraNs();                                                           \
+    heapRegistro##bytes##Ordenar(copia, n);                                            \
+    ns[2] = (benchAgoraNs() - inicio) / n;                                             \
+    for (int i = 0; i < n; i++) verificacao[2] += (long long) copia[i].prioridade * (i + 1); \
+    inicio = benchAgoraNs();                                                           \
+    heapsortIndireto(registros, n, sizeof(Registro##bytes),                            \
+                     offsetof(Registro##bytes, prioridade), permutacao);               \
+    for (int i = 0; i < n; i++) {                                                      \
+        copia[i] = registros[permutacao[i]];                                           \
+    }                                                                                  \
+    ns[3] = (benchAgoraNs() - inicio) / n;                                             \
+    for (int i = 0; i < n; i++) verificacao[3] += (long long) copia[i].prioridade * (i + 1); \
+    free(direta.array);                                                                \
+    liberarHeapIndireta(indireta);                                                     \
+    free(registros);                                                                   \
+    free(copia);                                                                       \
+    free(permutacao);                                                                  \
+}
+
+BENCH_REGISTRO(16)
+BENCH_REGISTRO(64)
+BENCH_REGISTRO(256)
+BENCH_REGISTRO(1024)
+
+void benchIndireta(void) {
+    const int n = 200000;
+    const int tamanhos[] = {16, 64, 256, 1024};
+    const int nTamanhos = sizeof(tamanhos) / sizeof(tamanhos[0]);
+
+    printf("--- Registros grandes: MaxHeap direta vs HeapIndireta (n=%d) ---\n", n);
+    printf("%8s %12s %12s %8s %14s %14s %8s\n", "bytes", "direta", "indireta", "razão",
+           "heapsort", "indireto+cópia", "razão");
+    for (int t = 0; t < nTamanhos; t++) {
+        double ns[4];
+        long long verificacao[4];
+        switch (tamanhos[t]) {
+            case 16: medirRegistros16(n, ns, verificacao); break;
+            case 64: medirRegistros64(n, ns, verificacao); break;
+            case 256: medirRegistros256(n, ns, verificacao); break;
+            default: medirRegistros1024(n, ns, verificacao); break;
+        }
+        if (ns[0] == 0.0) {
+            printf("%8d  (sem memória)\n", tamanhos[t]);
+            continue;
+        }
+        // Empates podem sair em outra ordem; a soma ponderada das prioridades e a dos ids não
+        int iguais = verificacao[0] == verificacao[1] && verificacao[2] == verificacao[3];
+        printf("%8d %12.1f %12.1f %8.2f %14.1f %14.1f %8.2f%s\n", tamanhos[t], ns[0], ns[1], ns[0] / ns[1],
+               ns[2], ns[3], ns[2] / ns[3], iguais ? "" : "  (FALHOU: ordens diferentes)");
+    }
+    printf("(ns por registro; heaps: n inserções + n extrações)\n\n");
+}
+
+// Layouts comparados em benchAlocacao
+enum { LAYOUT_SEPARADO, LAYOUT_BLOCO, LAYOUT_CHAMADOR, LAYOUT_ARENA, LAYOUT_QUANTIDADE };
+static const char *nomesLayout[LAYOUT_QUANTIDADE] = {"separado", "bloco", "chamador", "arena"};
+
+/**
+ * @brief Layout antigo de criarMaxHeap: struct e array em duas alocações.
+ */
+static MaxHeap* criarMaxHeapSeparada(int capacidade) {
+    MaxHeap *heap = (MaxHeap*) malloc(sizeof(MaxHeap));
+    Paciente *array = (Paciente*) malloc((size_t) capacidade * sizeof(Paciente));
+    if (heap == NULL || array == NULL) {
+        free(heap);
+        free(array);
+        return NULL;
+    }
+    inicializarMaxHeap(heap, array, capacidade, 0);
+    heap->arrayEmprestado = 0; // liberarMaxHeap devolve os dois blocos
+    return heap;
+}
+
+void benchAlocacao(void) {
+    const int quantidades[] = {1000, 10000, 100000};
+    const int nQuantidades = sizeof(quantidades) / sizeof(quantidades[0]);
+    const int capacidade = 32;
+    const int operacoes = 2000000;
+    const int ciclos = 4; // Criar/liberar repetidos: o primeiro ciclo paga as faltas de página
+
+    printf("--- Muitas heaps pequenas: alocação da struct e do array (capacidade %d) ---\n", capacidade);
+    printf("%10s %10s %18s %14s\n", "heaps", "layout", "criar+liberar (ns)", "ns/op");
+    for (int q = 0; q < nQuantidades; q++) {
+        int n = quantidades[q];
+        long long verificacao[LAYOUT_QUANTIDADE];
+        for (int layout = 0; layout < LAYOUT_QUANTIDADE; layout++) {
+            MaxHeap **heaps = (MaxHeap**) malloc((size_t) n * sizeof(MaxHeap*));
+            MaxHeap *structs = (MaxHeap*) malloc((size_t) n * sizeof(MaxHeap));
+            Paciente *armazenamento = (Paciente*) malloc((size_t) n * capacidade * sizeof(Paciente));
+            if (heaps == NULL || structs == NULL || armazenamento == NULL) {
+                free(heaps);
+                free(structs);
+                free(armazenamento);
+                return;
+            }
+            // A arena é esvaziada em bloco a cada ciclo e reusa os seus blocos
+            ArenaHeaps *arena = layout == LAYOUT_ARENA ? criarArenaHeaps(0) : NULL;
+            double melhorCriar = 0.0;
+            double nsOp = 0.0;
+            int criadas = 0;
+            for (int ciclo = 0; ciclo < ciclos; ciclo++) {
+                double inicio = benchAgoraNs();
+                for (criadas = 0; criadas < n; criadas++) {
+                    MaxHeap *h = NULL;
+                    switch (layout) {
+                        case LAYOUT_SEPARADO: h = criarMaxHeapSeparada(capacidade); break;
+                        case LAYOUT_BLOCO:    h = criarMaxHeap(capacidade); break;
+                        case LAYOUT_CHAMADOR:
+                            h = &structs[criadas];
+                            inicializarMaxHeap(h, armazenamento + (size_t) criadas * capacidade, capacidade, 0);
+                            break;
+                        default:              h = criarMaxHeapNaArena(arena, capacidade, 0); break;
+                    }
+                    if (h == NULL) break;
+                    heaps[criadas] = h;
+                }
+                double nsCriar = benchAgoraNs() - inicio;
+
+                // Último ciclo: departamentos sorteados, cada operação insere ou atende um paciente
+                if (ciclo == ciclos - 1 && criadas == n) {
+                    unsigned int estado = 57;
+                    verificacao[layout] = 0;
+                    inicio = benchAgoraNs();
+                    for (int i = 0; i < operacoes; i++) {
+                        Paciente p = pacienteAleatorio(&estado, i);
+                        MaxHeap *h = heaps[(unsigned int) p.id * 2654435761u % (unsigned int) n];
+                        if (h->tamanho < capacidade / 2 || (h->tamanho < capacidade && (p.prioridade & 1))) {
+                            inserirPacienteMax(h, p);
+                        } else {
+                            verificacao[layout] += extrairMaxPacienteHeap(h).prioridade;
+                        }
+                    }
+                    nsOp = (benchAgoraNs() - inicio) / operacoes;
+                }
+
+                inicio = benchAgoraNs();
+                if (layout == LAYOUT_SEPARADO || layout == LAYOUT_BLOCO) {
+                    for (int i = 0; i < criadas; i++) {
+                        liberarMaxHeap(heaps[i]);
+                    }
+                } else if (layout == LAYOUT_ARENA) {
+                    esvaziarArenaHeaps(arena);
+                }
+                nsCriar += benchAgoraNs() - inicio;
+                if (ciclo == 0 || nsCriar < melhorCriar) {
+                    melhorCriar = nsCriar;
+                }
+                if (criadas < n) break;
+            }
+            liberarArenaHeaps(arena);
+            free(heaps);
+            free(structs);
+            free(armazenamento);
+            if (criadas < n) {
+                printf("  Falha ao criar as heaps (%s)\n", nomesLayout[layout]);
+                return;
+            }
+            printf("%10d %10s %18.1f %14.1f%s\n", n, nomesLayout[layout], melhorCriar / n, nsOp,
+                   verificacao[layout] == verificacao[0] ? "" : "  (FALHOU: extrações diferentes)");
+        }
+    }
+    printf("\n");
+}
+
+static const char *nomesOperacaoHeap[HEAP_OP_QUANTIDADE] = {"inserir", "extrair", "lote", "ordenar"};
+
+static void imprimirEstatisticas(const char *titulo, const EstatisticasHeap *e) {
+    printf("%s: %llu comparações, %llu movimentos, %llu níveis (máx. %llu), %llu crescimentos, %llu rejeições\n",
+           titulo, e->comparacoes, e->movimentos, e->niveis, e->profundidadeMaxima, e->crescimentos,
+           e->rejeicoesCheia);
+    for (int op = 0; op < HEAP_OP_QUANTIDADE; op++) {
+        if (e->operacoes[op] == 0) {
+            continue;
+        }
+        printf("  %-8s %10llu ops |", nomesOperacaoHeap[op], e->operacoes[op]);
+        for (int f = 0; f < HEAP_HISTOGRAMA_FAIXAS; f++) {
+            if (e->latencia[op][f] > 0) {
+                printf(" <%lluns:%llu", 2ULL << f, e->latencia[op][f]);
+            }
+        }
+        printf("\n");
+    }
+}
+
+void benchInstrumentacao(void) {
+    const int n = 1000000;
+    Paciente *pacientes = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+    if (pacientes == NULL) {
+        return;
+    }
+    gerarPacientes(pacientes, n, DIST_UNIFORME, 29u);
+
+    EstatisticasHeap est;
+    obterEstatisticasHeapsort(&est);
+    printf("--- Instrumentação (n = %d, biblioteca %s) ---\n", n,
+           est.instrumentada ? "com HEAP_INSTRUMENTACAO" : "sem instrumentação");
+    printf("%16s %16s %16s\n", "inserir (ns/op)", "extrair (ns/op)", "heapsort (ms)");
+
+    MaxHeap *heap = criarMaxHeapExpansivel(0);
+    if (heap == NULL) {
+        free(pacientes);
+        return;
+    }
+    double inicio = benchAgoraNs();
+    for (int i = 0; i < n; i++) {
+        inserirPacienteMax(heap, pacientes[i]);
+    }
+    double nsInserir = (benchAgoraNs() - inicio) / n;
+    long long soma = 0;
+    inicio = benchAgoraNs();
+    for (int i = 0; i < n; i++) {
+        soma += extrairMaxPacienteHeap(heap).prioridade;
+    }
+    double nsExtrair = (benchAgoraNs() - inicio) / n;
+
+    zerarEstatisticasHeapsort();
+    inicio = benchAgoraNs();
+    heapsortPacientes(pacientes, n);
+    double msHeapsort = (benchAgoraNs() - inicio) / 1e6;
+    int ordenado = soma > 0;
+    for (int i = 1; i < n && ordenado; i++) {
+        ordenado = pacientes[i - 1].prioridade <= pacientes[i].prioridade;
+    }
+
+    printf("%16.1f %16.1f %16.2f%s\n", nsInserir, nsExtrair, msHeapsort, ordenado ? "" : "  (FALHOU)");
+
+    obterEstatisticasMaxHeap(heap, &est);
+    if (est.instrumentada) {
+        imprimirEstatisticas("MaxHeap", &est);
+        obterEstatisticasHeapsort(&est);
+        imprimirEstatisticas("Heapsort", &est);
+    } else {
+        printf("(compile com -DHEAP_INSTRUMENTACAO=ON e compare os tempos)\n");
+    }
+    liberarMaxHeap(heap);
+    free(pacientes);
+    printf("\n");
+}
+
+// Pacientes gerados/verificados por bloco na seção de ordenação externa
+#define BLOCO_EXTERNA (1 << 16)
+
+// Assinatura de um multiconjunto de pacientes, independente da ordem
+typedef struct {
+    long long registros;
+    unsigned long long soma;
+    unsigned long long somaMisturada;
+} AssinaturaPacientes;
+
+static void assinarPaciente(AssinaturaPacientes *a, Paciente p) {
+    unsigned long long chave = ((unsigned long long) (unsigned int) p.id << 32) | (unsigned int) p.prioridade;
+    a->registros++;
+    a->soma += chave;
+    a->somaMisturada += chave * 0x9E3779B97F4A7C15ULL ^ (chave >> 29);
+}
+
+void benchExterna(long long megabytes, long long memoriaMb, const char *diretorio) {
+    char caminhoEntrada[1024];
+    char caminhoSaida[1024];
+    snprintf(caminhoEntrada, sizeof(caminhoEntrada), "%s/bench_externa_entrada.bin", diretorio);
+    snprintf(caminhoSaida, sizeof(caminhoSaida), "%s/bench_externa_saida.bin", diretorio);
+
+    long long n = megabytes * 1024 * 1024 / (long long) sizeof(Paciente);
+    size_t memoria = (size_t) memoriaMb * 1024 * 1024;
+    Paciente *bloco = (Paciente*) malloc(BLOCO_EXTERNA * sizeof(Paciente));
+    FILE *arquivo = fopen(caminhoEntrada, "wb");
+    if (bloco == NULL || arquivo == NULL) {
+        fprintf(stderr, "Falha ao preparar %s\n", caminhoEntrada);
+        free(bloco);
+        if (arquivo != NULL) fclose(arquivo);
+        return;
+    }
+
+    // Entrada sintética uniforme, com assinatura para conferir a saída
+    AssinaturaPacientes esperada = {0, 0, 0};
+    unsigned int estado = 2024;
+    for (long long gerados = 0; gerados < n; ) {
+        int k = n - gerados < BLOCO_EXTERNA ? (int) (n - gerados) : BLOCO_EXTERNA;
+        for (int i = 0; i < k; i++) {
+            bloco[i] = pacienteAleatorio(&estado, (int) (gerados + i));
+            assinarPaciente(&esperada, bloco[i]);
+        }
+        fwrite(bloco, sizeof(Paciente), (size_t) k, arquivo);
+        gerados += k;
+    }
+    fclose(arquivo);
+
+    EstatisticasOrdenacaoExterna estatisticas;
+    double inicio = benchAgoraNs();
+    int status = ordenarArquivoPacientes(caminhoEntrada, caminhoSaida, memoria, &estatisticas);
+    double segundos = (benchAgoraNs() - inicio) / 1e9;
+
+    printf("--- Ordenação externa de %lld MB (%lld pacientes, memória %lld MB) ---\n",
+           megabytes, n, memoriaMb);
+    if (status != HEAP_OK) {
+        printf("Falha na ordenação (status %d)\n\n", status);
+    } else {
+        // Confere ordem, quantidade e assinatura da saída
+        AssinaturaPacientes obtida = {0, 0, 0};
+        long long foraDeOrdem = 0;
+        int anterior = -1;
+        size_t lidos;
+        arquivo = fopen(caminhoSaida, "rb");
+        while (arquivo != NULL && (lidos = fread(bloco, sizeof(Paciente), BLOCO_EXTERNA, arquivo)) > 0) {
+            for (size_t i = 0; i < lidos; i++) {
+                if (bloco[i].prioridade < anterior) foraDeOrdem++;
+                anterior = bloco[i].prioridade;
+                assinarPaciente(&obtida, bloco[i]);
+            }
+        }
+        if (arquivo != NULL) fclose(arquivo);
+        int correto = foraDeOrdem == 0 && obtida.registros == esperada.registros &&
+                      obtida.soma == esperada.soma && obtida.somaMisturada == esperada.somaMisturada;
+
+        printf("%12s %10s %10s %12s %10s\n", "tempo (s)", "MB/s", "corridas", "corrida/mem", "passadas");
+        printf("%12.2f %10.1f %10d %12.2f %10d\n", segundos, (double) megabytes / segundos,
+               estatisticas.corridas,
+               estatisticas.corridas > 0
+                   ? (double) n * sizeof(Paciente) / estatisticas.corridas / (double) (memoria / 2) : 0.0,
+               estatisticas.passadas);
+        printf("Verificação: %s (%lld pacientes, %lld fora de ordem)\n\n",
+               correto ? "ok" : "FALHOU", obtida.registros, foraDeOrdem);
+    }
+    remove(caminhoEntrada);
+    remove(caminhoSaida);
+    free(bloco);
+}
+
+#ifdef HEAP_TEM_PERSISTENCIA
+
+// Operações por execução do processo filho no teste de queda
+#define PERSISTENTE_OPERACOES 3000000
+
+/**
+ * @brief Operação i da sequência determinística do teste de queda:
+ * devolve 1 para inserção (preenchendo *p) e 0 para extração.
+ */
+static int operacaoPersistente(unsigned int *estado, int i, Paciente *p) {
+    *p = pacienteAleatorio(estado, i);
+    return *estado % 3 != 0;
+}
+
+/**
+ * @brief Executa as primeiras 'k' operações da sequência em uma MaxHeap comum.
+ */
+static MaxHeap* reproduzirOperacoes(long long k) {
+    MaxHeap *heap = criarMaxHeapExpansivel(16);
+    unsigned int estado = 31;
+    for (long long i = 0; i < k && heap != NULL; i++) {
+        Paciente p;
+        if (operacaoPersistente(&estado, (int) i, &p)) {
+            inserirPacienteMax(heap, p);
+        } else {
+            extrairMaxPacienteHeap(heap);
+        }
+    }
+    return heap;
+}
+
+/**
+ * @brief Um processo filho aplica a sequência de operações à heap persistente
+ * e é morto com SIGKILL em um momento aleatório. Ao reabrir, o conteúdo deve
+ * ser idêntico (posição a posição) ao de uma MaxHeap comum após as k ou k+1
+ * primeiras operações, onde k é o número de operações que o filho confirmou.
+ */
+static void testarQuedaPersistente(const char *caminho, int repeticoes) {
+    volatile long long *confirmadas = (volatile long long*) mmap(NULL, sizeof(long long), PROT_READ | PROT_WRITE,
+                                                                   MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (confirmadas == (volatile long long*) MAP_FAILED) {
+        perror("mmap");
+        return;
+    }
+    unsigned int estadoEspera = 5;
+    int aprovadas = 0;
+    for (int r = 0; r < repeticoes; r++) {
+        remove(caminho);
+        *confirmadas = 0;
+        pid_t filho = fork();
+        if (filho < 0) {
+            perror("fork");
+            break;
+        }
+        if (filho == 0) {
+            HeapPersistente *heap = abrirHeapPersistente(caminho, HEAP_PERSISTENTE_MAX, 16);
+            unsigned int estado = 31;
+            for (int i = 0; heap != NULL && i < PERSISTENTE_OPERACOES; i++) {
+                Paciente p;
+                if (operacaoPersistente(&estado, i, &p)) {
+                    inserirPacientePersistente(heap, p);
+                } else {
+                    extrairPacientePersistente(heap);
+                }
+                __atomic_thread_fence(__ATOMIC_SEQ_CST);
+                *confirmadas = i + 1;
+            }
+            _exit(0);
+        }
+        estadoEspera = estadoEspera * 1103515245u + 12345u;
+        usleep(1000 + (estadoEspera >> 16) % 100000);
+        kill(filho, SIGKILL);
+        waitpid(filho, NULL, 0);
+
+        long long k = *confirmadas;
+        HeapPersistente *heap = abrirHeapPersistente(caminho, HEAP_PERSISTENTE_MAX, 16);
+        int aprovada = 0;
+        for (long long extra = 0; heap != NULL && extra <= 1 && !aprovada; extra++) {
+            MaxHeap *referencia = reproduzirOperacoes(k + extra);
+            aprovada = referencia != NULL && referencia->tamanho == tamanhoHeapPersistente(heap) &&
+                       memcmp(referencia->array, heap->array, (size_t) referencia->tamanho * sizeof(Paciente)) == 0;
+            liberarMaxHeap(referencia);
+        }
+        printf("  queda %2d: %8lld operações confirmadas, %7d pacientes no arquivo: %s\n", r + 1, k,
+               tamanhoHeapPersistente(heap), aprovada ? "ok" : "FALHOU");
+        aprovadas += aprovada;
+        fecharHeapPersistente(heap);
+    }
+    printf("Consistência após queda: %d de %d execuções ok\n", aprovadas, repeticoes);
+    munmap((void*) confirmadas, sizeof(long long));
+    remove(caminho);
+}
+
+void benchPersistente(const char *diretorio) {
+    char caminhoHeap[1024];
+    char caminhoPlano[1024];
+    snprintf(caminhoHeap, sizeof(caminhoHeap), "%s/bench_persistente.heap", diretorio);
+    snprintf(caminhoPlano, sizeof(caminhoPlano), "%s/bench_persistente.bin", diretorio);
+
+    printf("--- Heap persistente: teste de queda (SIGKILL) ---\n");
+    testarQuedaPersistente(caminhoHeap, 10);
+
+    const int n = 10000000;
+    Paciente *pacientes = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+    if (pacientes == NULL) {
+        return;
+    }
+    gerarPacientes(pacientes, n, DIST_UNIFORME, 17u);
+    remove(caminhoHeap);
+    HeapPersistente *persistente = abrirHeapPersistente(caminhoHeap, HEAP_PERSISTENTE_MAX, n);
+    FILE *plano = fopen(caminhoPlano, "wb");
+    if (persistente == NULL || plano == NULL) {
+        fecharHeapPersistente(persistente);
+        if (plano != NULL) fclose(plano);
+        free(pacientes);
+        return;
+    }
+    for (int i = 0; i < n; i++) {
+        inserirPacientePersistente(persistente, pacientes[i]);
+    }
+    fecharHeapPersistente(persistente);
+    fwrite(pacientes, sizeof(Paciente), (size_t) n, plano);
+    fclose(plano);
+
+    printf("--- Heap persistente: tempo de reinício com n=%d (ms) ---\n", n);
+    printf("%-34s %12s %10s\n", "variante", "tempo (ms)", "topo");
+
+    double inicio = benchAgoraNs();
+    persistente = abrirHeapPersistente(caminhoHeap, HEAP_PERSISTENTE_MAX, 0);
+    int topo = persistente != NULL && !heapPersistenteVazia(persistente) ? persistente->array[0].prioridade : -1;
+    printf("%-34s %12.2f %10d\n", "reabrir arquivo mapeado", (benchAgoraNs() - inicio) / 1e6, topo);
+    fecharHeapPersistente(persistente);
+
+    for (int variante = 0; variante < 2; variante++) {
+        inicio = benchAgoraNs();
+        plano = fopen(caminhoPlano, "rb");
+        size_t lidos = plano != NULL ? fread(pacientes, sizeof(Paciente), (size_t) n, plano) : 0;
+        if (plano != NULL) fclose(plano);
+        MaxHeap *heap;
+        if (variante == 0) {
+            heap = criarMaxHeap((int) lidos);
+            for (size_t i = 0; heap != NULL && i < lidos; i++) {
+                inserirPacienteMax(heap, pacientes[i]);
+            }
+        } else {
+            heap = criarMaxHeapDeArray(pacientes, (int) lidos, 0);
+        }
+        double ms = (benchAgoraNs() - inicio) / 1e6;
+        topo = heap != NULL && !maxHeapVazia(heap) ? heap->array[0].prioridade : -1;
+        printf("%-34s %12.2f %10d\n", variante == 0 ? "arquivo plano + inserirPacienteMax" : "arquivo plano + Floyd", ms, topo);
+        liberarMaxHeap(heap);
+    }
+    printf("\n");
+    remove(caminhoHeap);
+    remove(caminhoPlano);
+    free(pacientes);
+}
+
+#endif // HEAP_TEM_PERSISTENCIA
+
+/**
+ * @brief KiB do processo em páginas grandes (AnonHugePages + Private_Hugetlb de
+ * /proc/self/smaps_rollup), ou -1 fora do Linux.
+ */
+static long long paginasGrandesProcessoKb(void) {
+    FILE *f = fopen("/proc/self/smaps_rollup", "r");
+    if (f == NULL) return -1;
+    char linha[256];
+    long long total = 0;
+    long long kb;
+    while (fgets(linha, sizeof(linha), f) != NULL) {
+        if (sscanf(linha, "AnonHugePages: %lld kB", &kb) == 1
+            || sscanf(linha, "Private_Hugetlb: %lld kB", &kb) == 1) {
+            total += kb;
+        }
+    }
+    fclose(f);
+    return total;
+}
+
+/**
+ * @brief Paciente com prioridade de 31 bits (quase sem empates, para que cada
+ * extração desça até perto das folhas mesmo com bilhões de pacientes).
+ */
+static Paciente pacienteLargaEscala(unsigned int *estado, long long id) {
+    *estado = *estado * 1103515245u + 12345u;
+    Paciente p = {(int) (id & 0x7fffffff), (int) (*estado >> 1)};
+    return p;
+}
+
+void benchLargaEscala(long long nMaximo) {
+    const long long operacoes = 2000000;
+
+    printf("--- Larga escala: MaxHeap com índices de %d bits, páginas normais vs grandes ---\n",
+           (int) (sizeof(HeapIndice) * 8));
+    printf("%12s %14s %10s %16s %16s %14s\n", "n", "páginas", "MiB", "inserir (ns)", "ext+ins (ns)", "grandes (MiB)");
+    for (long long n = 1LL << 22; n <= nMaximo; n *= 4) {
+        if (n > (long long) HEAP_TAMANHO_MAX) {
+            printf("%12lld acima de HEAP_TAMANHO_MAX (%lld): compile com -DHEAP_LARGA_ESCALA=ON\n",
+                   n, (long long) HEAP_TAMANHO_MAX);
+            break;
+        }
+        for (int modo = PAGINAS_NORMAIS; modo <= PAGINAS_EXPLICITAS; modo++) {
+            long long antesKb = paginasGrandesProcessoKb();
+            MaxHeap *heap = criarMaxHeapExpansivel(0);
+            if (heap == NULL || definirPaginasMaxHeap(heap, (ModoPaginas) modo) != HEAP_OK
+                || reservarMaxHeap(heap, (HeapIndice) n) != HEAP_OK) {
+                printf("%12lld %14s sem memória\n", n, nomeModoPaginas((ModoPaginas) modo));
+                liberarMaxHeap(heap);
+                continue;
+            }
+            unsigned int estado = 42;
+            double inicio = benchAgoraNs();
+            for (long long i = 0; i < n; i++) {
+                inserirPacienteMax(heap, pacienteLargaEscala(&estado, i));
+            }
+            double nsInserir = (benchAgoraNs() - inicio) / (double) n;
+            long long grandesKb = antesKb >= 0 ? paginasGrandesProcessoKb() - antesKb : -1;
+
+            // Regime estável: cada extração desce até perto das folhas, onde as
+            // falhas de TLB se concentram
+            inicio = benchAgoraNs();
+            for (long long i = 0; i < operacoes; i++) {
+                extrairMaxPacienteHeap(heap);
+                inserirPacienteMax(heap, pacienteLargaEscala(&estado, n + i));
+            }
+            double nsOperacao = (benchAgoraNs() - inicio) / (double) operacoes;
+            int valida = heap->tamanho == (HeapIndice) n;
+            for (HeapIndice i = 1; valida && i < heap->tamanho; i += 4099) {
+                valida = heap->array[heapPai(i)].prioridade >= heap->array[i].prioridade;
+            }
+
+            printf("%12lld %14s %10lld %16.1f %16.1f %14lld%s\n", n, nomeModoPaginas((ModoPaginas) modo),
+                   (long long) ((n * (long long) sizeof(Paciente)) >> 20), nsInserir, nsOperacao,
+                   grandesKb >= 0 ? grandesKb / 1024 : -1, valida ? "" : "  HEAP INVÁLIDA");
+            liberarMaxHeap(heap);
+        }
+    }
+    printf("\n");
+}
@@ -0,0 +1,163 @@
+#ifndef BENCH_SECOES_H
+#define BENCH_SECOES_H
+
+// Seções específicas do bench_heap, cada uma comparando variantes de uma
+// otimização (selecionadas com --secao).
+
+/**
+ * @brief Inserção amortizada: capacidade fixa vs heap expansível.
+ */
+void benchCrescimento(void);
+
+/**
+ * @brief Inserção individual vs inserirLoteMax para diferentes razões k/n.
+ * @param crescente Se diferente de 0, o lote tem prioridades crescentes.
+ */
+void benchLote(int crescente);
+
+/**
+ * @brief Max-Heap binária vs d-ária de 10^4 a 10^7 elementos.
+ */
+void benchDary(void);
+
+/**
+ * @brief Variantes de heapsort: comparações, movimentos e tempo.
+ */
+void benchHeapsort(void);
+
+/**
+ * @brief Heapsort vs radix sort LSD vs ordenarPacientes (escolha automática):
+ * ns por elemento para n de 10^2 a 10^7 e prioridades de 0..7 a 31 bits, com
+ * verificação de ordem.
+ */
+void benchRadix(void);
+
+#ifdef HEAP_TEM_FILA_CONCORRENTE
+/**
+ * @brief Estresse e escala da fila concorrente (1 até maxThreads produtores e
+ * consumidores), comparada a uma MaxHeap com trava global. Verifica que cada
+ * paciente é extraído exatamente uma vez.
+ */
+void benchConcorrente(int maxThreads);
+#endif
+
+/**
+ * @brief Speedup de ordenarPacientesParalelo sobre heapsortPacientes (n = 10^7)
+ * para 1 até maxThreads threads.
+ */
+void benchParalelo(int maxThreads);
+
+/**
+ * @brief Custo do desempate FIFO com 8 prioridades distintas: MaxHeap
+ * instável, MaxHeapChegada (comparação de dois campos) e MaxHeapEstavel (chave
+ * de 64 bits), além de Heapsort vs heapsortPacientesEstavel. Conta as
+ * inversões de ordem de chegada na saída.
+ */
+void benchEstavel(void);
+
+/**
+ * @brief MaxHeap vs FilaBaldes em regime estável (extrair + inserir com n
+ * pacientes na fila) para escala de 1000 níveis, 8 níveis e uma triagem
+ * clínica de 5 níveis com pesos desiguais.
+ */
+void benchBaldes(void);
+
+/**
+ * @brief Seleção dos k mais urgentes (n = 10^6 e 10^7, k de 10 a 10^5):
+ * heapsort completo, topKPacientes, AcumuladorTopK paciente a paciente e
+ * ordenarParcialPacientes, conferindo que todos devolvem as mesmas prioridades.
+ */
+void benchTopK(void);
+
+/**
+ * @brief Fila de prioridade dupla com n pacientes: rodadas de inserção,
+ * extração do maior, inserção e extração do menor, comparando uma MaxHeap e
+ * uma MinHeap paralelas com remoção preguiçosa contra a HeapMinMax (tempo por
+ * operação e bytes por paciente).
+ */
+void benchMinMax(void);
+
+/**
+ * @brief Envelhecimento de prioridades com n pacientes na fila: reescrever as
+ * prioridades efetivas e reconstruir a MaxHeap a cada tique do relógio vs a
+ * FilaEnvelhecimento (chaves invariantes e migração preguiçosa), com o tempo
+ * total e o pior tique.
+ */
+void benchEnvelhecimento(void);
+
+/**
+ * @brief Fusão de duas filas de n pacientes: extração e reinserção na MaxHeap,
+ * fundirMaxHeaps (concatenação + Floyd) e fundirPairingHeaps (O(1)), além do
+ * custo de inserção e extração de cada estrutura.
+ */
+void benchFusao(void);
+
+/**
+ * @brief Extração dos k mais urgentes (troca de turno): k chamadas de
+ * extrairMaxPacienteHeap versus extrairLoteMax, para n de 10^3 a 10^6 e k de
+ * 20 a n/4, em ns por paciente, e as comparações por paciente do laço e da
+ * extração pela fronteira (HEAP_COMPARACAO_CARA). Os pacientes extraídos são
+ * reinseridos entre as rodadas.
+ */
+void benchExtrairLote(void);
+
+/**
+ * @brief Rajadas de chegadas (ex.: ambulâncias): k inserções, uma espiada e k
+ * extrações na MaxHeap, com inserção imediata e com inserção adiada
+ * (definirInsercaoAdiadaMaxHeap), para n de 10^5 e 10^6, k de 1 a n/2 e
+ * prioridades aleatórias ou crescentes (pior caso do heapify-up).
+ */
+void benchInsercaoAdiada(void);
+
+/**
+ * @brief Registros de 16 a 1024 bytes: n inserções e n extrações na MaxHeap
+ * direta (que move o registro inteiro a cada nível) e na HeapIndireta (que
+ * move pares de 8 bytes), e o heapsort do array de registros comparado ao
+ * heapsortIndireto seguido da cópia na ordem da permutação.
+ */
+void benchIndireta(void);
+
+/**
+ * @brief Muitas heaps pequenas (uma por departamento): custo de criar e
+ * liberar e ns por operação com departamentos sorteados, comparando struct e
+ * array em alocações separadas (layout antigo), bloco único, memória do
+ * chamador e arena.
+ */
+void benchAlocacao(void);
+
+/**
+ * @brief Custo da instrumentação: ns por inserção e extração na MaxHeap e
+ * tempo do Heapsort com n = 10^6, seguidos das estatísticas coletadas quando a
+ * biblioteca foi compilada com HEAP_INSTRUMENTACAO. Rodar com e sem a opção
+ * mostra o custo dos contadores.
+ */
+void benchInstrumentacao(void);
+
+/**
+ * @brief Ordenação externa de um arquivo sintético de 'megabytes' MB com
+ * orçamento de 'memoriaMb' MB: vazão, corridas geradas (e seu tamanho relativo
+ * à heap) e verificação de ordem, quantidade e conteúdo da saída.
+ * @param diretorio Onde os arquivos temporários de entrada e saída são criados.
+ */
+void benchExterna(long long megabytes, long long memoriaMb, const char *diretorio);
+
+#ifdef HEAP_TEM_PERSISTENCIA
+/**
+ * @brief Heap persistente: teste de consistência após queda (processo filho
+ * morto com SIGKILL no meio das operações) e tempo de reinício (reabrir o
+ * arquivo mapeado vs reconstruir a partir de um arquivo plano), n = 10^7.
+ * @param diretorio Onde os arquivos são criados.
+ */
+void benchPersistente(const char *diretorio);
+#endif
+
+/**
+ * @brief MaxHeap de 4 * 2^20 até 'nMaximo' pacientes (passos de 4x) com o array
+ * em páginas normais, transparentes e explícitas: ns por inserção e por par
+ * extração + inserção em regime estável, e quanto do array ficou em páginas
+ * grandes. Tamanhos acima de HEAP_TAMANHO_MAX exigem HEAP_LARGA_ESCALA.
+ * @param nMaximo Maior número de pacientes (ex.: bilhões, com memória para 8 bytes cada).
+ */
+void benchLargaEscala(long long nMaximo);
+
+#endif // BENCH_SECOES_H
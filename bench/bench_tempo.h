@@ -0,0 +1,34 @@
+#ifndef BENCH_TEMPO_H
+#define BENCH_TEMPO_H
+
+// Relógio monotônico de alta resolução para os benchmarks.
+
+#ifdef _WIN32
+#include <windows.h>
+
+/**
+ * @brief Retorna o instante atual em nanossegundos (relógio monotônico).
+ */
+static double benchAgoraNs(void) {
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER t;
+    if (freq.QuadPart == 0) {
+        QueryPerformanceFrequency(&freq);
+    }
+    QueryPerformanceCounter(&t);
+    return (double) t.QuadPart * 1e9 / (double) freq.QuadPart;
+}
+#else
+#include <time.h>
+
+/**
+ * @brief Retorna o instante atual em nanossegundos (relógio monotônico).
+ */
+static double benchAgoraNs(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double) t.tv_sec * 1e9 + (double) t.tv_nsec;
+}
+#endif
+
+#endif // BENCH_TEMPO_H
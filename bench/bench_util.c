@@ -0,0 +1,127 @@
+#include "bench_util.h"
+#include <stdlib.h>
+
+static FILE *relatorioSaida;
+static FormatoRelatorio relatorioFormato;
+static int relatorioLinhas;
+
+Paciente pacienteAleatorio(unsigned int *estado, int id) {
+    *estado = *estado * 1103515245u + 12345u;
+    Paciente p = {id, (int) ((*estado >> 16) % 1000)};
+    return p;
+}
+
+void gerarPacientes(Paciente array[], long long n, Distribuicao dist, unsigned int semente) {
+    unsigned int estado = semente;
+    for (long long i = 0; i < n; i++) {
+        Paciente p = pacienteAleatorio(&estado, (int) i);
+        switch (dist) {
+            case DIST_POUCAS:
+                p.prioridade %= 8;
+                break;
+            case DIST_ORDENADA:
+                p.prioridade = (int) i;
+                break;
+            case DIST_REVERSA:
+                p.prioridade = (int) (n - i);
+                break;
+            default:
+                break;
+        }
+        array[i] = p;
+    }
+}
+
+const char* nomeDistribuicao(Distribuicao dist) {
+    switch (dist) {
+        case DIST_UNIFORME: return "uniforme";
+        case DIST_POUCAS:   return "poucas";
+        case DIST_ORDENADA: return "ordenada";
+        case DIST_REVERSA:  return "reversa";
+        default:            return "?";
+    }
+}
+
+/**
+ * @brief Comparação de doubles para qsort.
+ */
+static int compararDouble(const void *a, const void *b) {
+    double x = *(const double*) a;
+    double y = *(const double*) b;
+    return (x > y) - (x < y);
+}
+
+/**
+ * @brief Percentil por posição mais próxima em um array já ordenado.
+ */
+static double percentil(const double ordenadas[], long long n, double q) {
+    long long i = (long long) (q * (double) (n - 1) + 0.5);
+    return ordenadas[i];
+}
+
+void resumirAmostras(double amostras[], long long nAmostras, ResultadoBench *r) {
+    if (nAmostras <= 0) {
+        r->nsPorOp = r->p50 = r->p90 = r->p99 = r->p999 = r->mopsPorSeg = 0.0;
+        return;
+    }
+    double soma = 0.0;
+    for (long long i = 0; i < nAmostras; i++) {
+        soma += amostras[i];
+    }
+    qsort(amostras, (size_t) nAmostras, sizeof(double), compararDouble);
+    r->nsPorOp = soma / (double) nAmostras;
+    r->p50 = percentil(amostras, nAmostras, 0.50);
+    r->p90 = percentil(amostras, nAmostras, 0.90);
+    r->p99 = percentil(amostras, nAmostras, 0.99);
+    r->p999 = percentil(amostras, nAmostras, 0.999);
+    r->mopsPorSeg = r->nsPorOp > 0.0 ? 1e3 / r->nsPorOp : 0.0;
+}
+
+void relatorioIniciar(FILE *saida, FormatoRelatorio formato) {
+    relatorioSaida = saida;
+    relatorioFormato = formato;
+    relatorioLinhas = 0;
+    switch (formato) {
+        case FORMATO_CSV:
+            fprintf(saida, "estrutura,operacao,distribuicao,n,operacoes,ns_por_op,p50,p90,p99,p999,mops_por_seg\n");
+            break;
+        case FORMATO_JSON:
+            fprintf(saida, "[\n");
+            break;
+        default:
+            fprintf(saida, "%-10s %-11s %-9s %10s %9s %9s %9s %9s %9s %9s\n",
+                    "estrutura", "operacao", "dist.", "n", "ns/op", "p50", "p90", "p99", "p99.9", "Mops/s");
+            break;
+    }
+}
+
+void relatorioAdicionar(const ResultadoBench *r) {
+    switch (relatorioFormato) {
+        case FORMATO_CSV:
+            fprintf(relatorioSaida, "%s,%s,%s,%lld,%lld,%.3f,%.3f,%.3f,%.3f,%.3f,%.4f\n",
+                    r->estrutura, r->operacao, r->distribuicao, r->n, r->operacoes,
+                    r->nsPorOp, r->p50, r->p90, r->p99, r->p999, r->mopsPorSeg);
+            break;
+        case FORMATO_JSON:
+            fprintf(relatorioSaida,
+                    "%s  {\"estrutura\": \"%s\", \"operacao\": \"%s\", \"distribuicao\": \"%s\", "
+                    "\"n\": %lld, \"operacoes\": %lld, \"ns_por_op\": %.3f, \"p50\": %.3f, "
+                    "\"p90\": %.3f, \"p99\": %.3f, \"p999\": %.3f, \"mops_por_seg\": %.4f}",
+                    relatorioLinhas > 0 ? ",\n" : "", r->estrutura, r->operacao, r->distribuicao,
+                    r->n, r->operacoes, r->nsPorOp, r->p50, r->p90, r->p99, r->p999, r->mopsPorSeg);
+            break;
+        default:
+            fprintf(relatorioSaida, "%-10s %-11s %-9s %10lld %9.2f %9.2f %9.2f %9.2f %9.2f %9.2f\n",
+                    r->estrutura, r->operacao, r->distribuicao, r->n,
+                    r->nsPorOp, r->p50, r->p90, r->p99, r->p999, r->mopsPorSeg);
+            break;
+    }
+    fflush(relatorioSaida);
+    relatorioLinhas++;
+}
+
+void relatorioFinalizar(void) {
+    if (relatorioFormato == FORMATO_JSON) {
+        fprintf(relatorioSaida, "%s]\n", relatorioLinhas > 0 ? "\n" : "");
+    }
+}
@@ -0,0 +1,77 @@
+#ifndef BENCH_UTIL_H
+#define BENCH_UTIL_H
+
+#include <stdio.h>
+#include "includes/paciente.h"
+
+// Distribuições de prioridade usadas para gerar as entradas dos benchmarks
+typedef enum {
+    DIST_UNIFORME,   // Prioridades aleatórias uniformes em [0, 1000)
+    DIST_POUCAS,     // Poucas prioridades distintas (8 níveis de triagem)
+    DIST_ORDENADA,   // Prioridades crescentes
+    DIST_REVERSA,    // Prioridades decrescentes
+    DIST_QUANTIDADE  // Número de distribuições (não é uma distribuição)
+} Distribuicao;
+
+// Formatos de saída do relatório
+typedef enum {
+    FORMATO_TEXTO,
+    FORMATO_CSV,
+    FORMATO_JSON
+} FormatoRelatorio;
+
+// Resultado de uma medição (uma operação, distribuição e tamanho)
+typedef struct {
+    const char *estrutura;     // Ex.: "max_heap"
+    const char *operacao;      // Ex.: "inserir"
+    const char *distribuicao;  // Nome da distribuição de entrada
+    long long n;               // Tamanho da entrada
+    long long operacoes;       // Número total de operações medidas
+    double nsPorOp;            // Média em ns por operação
+    double p50, p90, p99, p999; // Percentis de ns por operação entre as amostras
+    double mopsPorSeg;         // Vazão em milhões de operações por segundo
+} ResultadoBench;
+
+/**
+ * @brief Gera um paciente pseudoaleatório (LCG simples e reprodutível).
+ * @param estado Estado do gerador, atualizado a cada chamada.
+ * @param id Identificador do paciente gerado.
+ */
+Paciente pacienteAleatorio(unsigned int *estado, int id);
+
+/**
+ * @brief Preenche 'array' com n pacientes seguindo a distribuição dada.
+ * @param semente Semente do gerador, para entradas reprodutíveis.
+ */
+void gerarPacientes(Paciente array[], long long n, Distribuicao dist, unsigned int semente);
+
+/**
+ * @brief Retorna o nome curto da distribuição (usado nos relatórios).
+ */
+const char* nomeDistribuicao(Distribuicao dist);
+
+/**
+ * @brief Preenche os percentis e a média de 'r' a partir de amostras em ns/op.
+ * As amostras são reordenadas.
+ * @param amostras Tempos por operação de cada amostra (ns).
+ * @param nAmostras Número de amostras.
+ * @param r Resultado a preencher (nsPorOp, p50, p90, p99, p999, mopsPorSeg).
+ */
+void resumirAmostras(double amostras[], long long nAmostras, ResultadoBench *r);
+
+/**
+ * @brief Inicia o relatório no formato escolhido (cabeçalho da tabela/CSV/JSON).
+ */
+void relatorioIniciar(FILE *saida, FormatoRelatorio formato);
+
+/**
+ * @brief Acrescenta um resultado ao relatório.
+ */
+void relatorioAdicionar(const ResultadoBench *r);
+
+/**
+ * @brief Finaliza o relatório (fecha o array JSON, se for o caso).
+ */
+void relatorioFinalizar(void);
+
+#endif // BENCH_UTIL_H
@@ -0,0 +1,109 @@
+#include "arena_heaps.h"
+#include <stdint.h> // SIZE_MAX
+
+// Os dados de um bloco começam no primeiro múltiplo de ARENA_ALINHAMENTO após o cabeçalho
+#define ARENA_CABECALHO_BLOCO \
+    ((sizeof(BlocoArena) + ARENA_ALINHAMENTO - 1) / ARENA_ALINHAMENTO * ARENA_ALINHAMENTO)
+
+static unsigned char* dadosBloco(BlocoArena *bloco) {
+    return (unsigned char*) bloco + ARENA_CABECALHO_BLOCO;
+}
+
+ArenaHeaps* criarArenaHeaps(size_t tamanhoBloco) {
+    ArenaHeaps *arena = (ArenaHeaps*) calloc(1, sizeof(ArenaHeaps));
+    if (arena == NULL) {
+        perror("Falha ao alocar memória para a arena (ArenaHeaps)");
+        return NULL;
+    }
+    arena->tamanhoBloco = tamanhoBloco > 0 ? tamanhoBloco : ARENA_BLOCO_PADRAO;
+    return arena;
+}
+
+void* alocarArenaHeaps(ArenaHeaps *arena, size_t bytes) {
+    if (arena == NULL || bytes > SIZE_MAX - ARENA_CABECALHO_BLOCO - ARENA_ALINHAMENTO) {
+        return NULL;
+    }
+    // Mantém o próximo recorte alinhado
+    size_t alinhado = (bytes + ARENA_ALINHAMENTO - 1) / ARENA_ALINHAMENTO * ARENA_ALINHAMENTO;
+    BlocoArena *bloco = arena->blocos;
+    if (bloco == NULL || bloco->tamanho - bloco->usado < alinhado) {
+        BlocoArena *novo;
+        if (alinhado <= arena->tamanhoBloco && arena->livres != NULL) {
+            novo = arena->livres;
+            arena->livres = novo->proximo;
+        } else {
+            size_t tamanho = alinhado > arena->tamanhoBloco ? alinhado : arena->tamanhoBloco;
+            novo = (BlocoArena*) malloc(ARENA_CABECALHO_BLOCO + tamanho);
+            if (novo == NULL) {
+                return NULL;
+            }
+            novo->tamanho = tamanho;
+        }
+        novo->usado = 0;
+        if (bloco != NULL && alinhado > arena->tamanhoBloco) {
+            // Bloco exclusivo de um pedido grande: fica atrás do atual, que
+            // continua recebendo os recortes pequenos
+            novo->proximo = bloco->proximo;
+            bloco->proximo = novo;
+        } else {
+            novo->proximo = bloco;
+            arena->blocos = novo;
+        }
+        bloco = novo;
+    }
+    void *recorte = dadosBloco(bloco) + bloco->usado;
+    bloco->usado += alinhado;
+    arena->bytesRecortados += bytes;
+    return recorte;
+}
+
+int registrarFinalizadorArenaHeaps(ArenaHeaps *arena, void (*finalizar)(void *objeto), void *objeto) {
+    if (arena == NULL || finalizar == NULL) return HEAP_ERRO_PARAMETRO;
+    FinalizadorArena *registro = (FinalizadorArena*) alocarArenaHeaps(arena, sizeof(FinalizadorArena));
+    if (registro == NULL) return HEAP_ERRO_MEMORIA;
+    registro->finalizar = finalizar;
+    registro->objeto = objeto;
+    registro->proximo = arena->finalizadores;
+    arena->finalizadores = registro;
+    return HEAP_OK;
+}
+
+/**
+ * @brief Chama os finalizadores (do mais recente ao mais antigo) e os descarta.
+ */
+static void finalizarObjetosArena(ArenaHeaps *arena) {
+    for (FinalizadorArena *f = arena->finalizadores; f != NULL; f = f->proximo) {
+        f->finalizar(f->objeto);
+    }
+    arena->finalizadores = NULL;
+}
+
+void esvaziarArenaHeaps(ArenaHeaps *arena) {
+    if (arena == NULL) return;
+    finalizarObjetosArena(arena);
+    BlocoArena *bloco = arena->blocos;
+    while (bloco != NULL) {
+        BlocoArena *proximo = bloco->proximo;
+        if (bloco->tamanho == arena->tamanhoBloco) {
+            bloco->proximo = arena->livres;
+            arena->livres = bloco;
+        } else {
+            free(bloco);
+        }
+        bloco = proximo;
+    }
+    arena->blocos = NULL;
+    arena->bytesRecortados = 0;
+}
+
+void liberarArenaHeaps(ArenaHeaps *arena) {
+    if (arena == NULL) return;
+    esvaziarArenaHeaps(arena);
+    BlocoArena *bloco = arena->livres;
+    while (bloco != NULL) {
+        BlocoArena *proximo = bloco->proximo;
+        free(bloco);
+        bloco = proximo;
+    }
+    free(arena);
+}
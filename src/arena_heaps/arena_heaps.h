@@ -0,0 +1,76 @@
+#ifndef ARENA_HEAPS_H
+#define ARENA_HEAPS_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Arena para criar muitas heaps pequenas (ex.: uma fila por departamento)
+// sem uma alocação por heap: cada heap (struct e array juntos) é recortada de
+// blocos grandes e todas são liberadas de uma vez com liberarArenaHeaps.
+// Heaps expansíveis que cresceram além do espaço recortado registram um
+// finalizador, chamado na liberação para devolver o array próprio.
+
+// Alinhamento de cada recorte (suficiente para ponteiros, long long e double)
+#define ARENA_ALINHAMENTO 16
+
+// Tamanho padrão de um bloco da arena
+#define ARENA_BLOCO_PADRAO (64 * 1024)
+
+// Bloco da arena; os dados começam logo após o cabeçalho
+typedef struct BlocoArena {
+    struct BlocoArena *proximo;
+    size_t tamanho; // Bytes de dados do bloco
+    size_t usado;   // Bytes já recortados
+} BlocoArena;
+
+// Finalizador registrado por um objeto da arena
+typedef struct FinalizadorArena {
+    void (*finalizar)(void *objeto);
+    void *objeto;
+    struct FinalizadorArena *proximo;
+} FinalizadorArena;
+
+typedef struct {
+    BlocoArena *blocos;             // Blocos em uso, o atual primeiro
+    BlocoArena *livres;             // Blocos devolvidos por esvaziarArenaHeaps, reusados antes de novos
+    size_t tamanhoBloco;
+    size_t bytesRecortados;         // Total entregue por alocarArenaHeaps
+    FinalizadorArena *finalizadores; // Chamados em ordem inversa de registro
+} ArenaHeaps;
+
+/**
+ * @brief Cria uma arena vazia (o primeiro bloco é alocado no primeiro recorte).
+ * @param tamanhoBloco Bytes por bloco (0 usa ARENA_BLOCO_PADRAO). Pedidos
+ * maiores que um bloco recebem um bloco exclusivo.
+ * @return Ponteiro para a ArenaHeaps criada, ou NULL em caso de falha.
+ */
+ArenaHeaps* criarArenaHeaps(size_t tamanhoBloco);
+
+/**
+ * @brief Recorta 'bytes' da arena, alinhados a ARENA_ALINHAMENTO. A memória
+ * não é zerada e só é devolvida por esvaziarArenaHeaps/liberarArenaHeaps.
+ * @return Ponteiro para a memória, ou NULL em caso de falha.
+ */
+void* alocarArenaHeaps(ArenaHeaps *arena, size_t bytes);
+
+/**
+ * @brief Registra 'finalizar(objeto)' para ser chamado quando a arena for
+ * esvaziada ou liberada (o registro ocupa memória da própria arena).
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int registrarFinalizadorArenaHeaps(ArenaHeaps *arena, void (*finalizar)(void *objeto), void *objeto);
+
+/**
+ * @brief Chama os finalizadores e devolve todos os recortes, mantendo os
+ * blocos de tamanho padrão para reuso (blocos exclusivos de pedidos grandes
+ * são liberados). As heaps criadas na arena deixam de ser válidas.
+ */
+void esvaziarArenaHeaps(ArenaHeaps *arena);
+
+/**
+ * @brief Chama os finalizadores e libera a arena com todos os seus blocos.
+ */
+void liberarArenaHeaps(ArenaHeaps *arena);
+
+#endif // ARENA_HEAPS_H
@@ -0,0 +1,316 @@
+#include "dary_heap.h"
+#include <limits.h> // INT_MAX
+#include <stdint.h> // uintptr_t
+#include <string.h> // memcpy
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define DARY_SIMD 1
+#include <emmintrin.h> // SSE2
+#if defined(__SSE4_1__) || defined(__AVX2__)
+#include <smmintrin.h> // _mm_max_epi32
+#endif
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h> // _BitScanForward
+#endif
+
+// O índice lógico i fica na posição i + DARY_DESLOCAMENTO do bloco alinhado.
+// Assim o primeiro filho de qualquer nó (d*i + 1) começa em múltiplo de d
+// elementos, e os d filhos (d * 8 bytes) ficam dentro de uma linha de cache.
+#define DARY_DESLOCAMENTO (DARY_ARIDADE - 1)
+
+// Maior capacidade suportada: com índices int, o primeiro filho (d*i + 1) de
+// qualquer nó e o primeiro neto usado na antecipação ainda cabem em int.
+#define DARY_CAPACIDADE_MAX ((INT_MAX - 1) / DARY_ARIDADE)
+
+// Funções auxiliares estáticas
+
+/**
+ * @brief Retorna o índice do pai do nó i.
+ * @param i Índice do nó.
+ * @return Índice do pai.
+ */
+static int paiDary(int i) {
+    return (i - 1) / DARY_ARIDADE;
+}
+
+/**
+ * @brief Retorna o índice do primeiro filho do nó i.
+ * @param i Índice do nó.
+ * @return Índice do primeiro filho.
+ */
+static int primeiroFilhoDary(int i) {
+    return DARY_ARIDADE * i + 1;
+}
+
+/**
+ * @brief Retorna a posição do bit menos significativo ligado de 'mascara' (não nula).
+ */
+static int bitMenosSignificativo(unsigned int mascara) {
+#ifdef _MSC_VER
+    unsigned long indice;
+    _BitScanForward(&indice, mascara);
+    return (int) indice;
+#else
+    return __builtin_ctz(mascara);
+#endif
+}
+
+/**
+ * @brief Encontra, de forma escalar, o filho de maior prioridade entre
+ * 'primeiro' e o fim da heap (usado para o último grupo incompleto).
+ * @return Índice absoluto do maior filho.
+ */
+static int maiorFilhoEscalar(const Paciente array[], int primeiro, int n) {
+    int maior = primeiro;
+    int fim = primeiro + DARY_ARIDADE < n ? primeiro + DARY_ARIDADE : n;
+    for (int c = primeiro + 1; c < fim; c++) {
+        if (array[c].prioridade > array[maior].prioridade) {
+            maior = c;
+        }
+    }
+    return maior;
+}
+
+#ifdef DARY_SIMD
+
+/**
+ * @brief Máximo elemento a elemento de inteiros de 32 bits com sinal.
+ * SSE2 não tem _mm_max_epi32; emula com comparação e seleção por máscara.
+ */
+static __m128i maxEpi32(__m128i a, __m128i b) {
+#if defined(__SSE4_1__) || defined(__AVX2__)
+    return _mm_max_epi32(a, b);
+#else
+    __m128i maior = _mm_cmpgt_epi32(a, b);
+    return _mm_or_si128(_mm_and_si128(maior, a), _mm_andnot_si128(maior, b));
+#endif
+}
+
+/**
+ * @brief Extrai as prioridades de 4 Pacientes consecutivos (alinhados a 16 bytes).
+ * Os Pacientes são pares (id, prioridade); as prioridades são as posições ímpares.
+ */
+static __m128i prioridades4(const Paciente *filhos) {
+    __m128 a = _mm_load_ps((const float*) filhos);
+    __m128 b = _mm_load_ps((const float*) (filhos + 2));
+    return _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+/**
+ * @brief Espalha o máximo horizontal de 'v' por todas as 4 posições.
+ */
+static __m128i maxHorizontal4(__m128i v) {
+    v = maxEpi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return maxEpi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+}
+
+/**
+ * @brief Encontra o filho de maior prioridade entre DARY_ARIDADE filhos
+ * presentes, com comparação vetorizada.
+ * @param filhos Ponteiro para o primeiro filho (alinhado a DARY_ARIDADE * 8 bytes).
+ * @return Deslocamento (0 a DARY_ARIDADE - 1) do maior filho.
+ */
+static int maiorFilhoSimd(const Paciente *filhos) {
+#if DARY_ARIDADE == 4
+    __m128i p = prioridades4(filhos);
+    __m128i m = maxHorizontal4(p);
+    return bitMenosSignificativo((unsigned int) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(p, m))));
+#elif defined(__AVX2__)
+    __m256 a = _mm256_load_ps((const float*) filhos);
+    __m256 b = _mm256_load_ps((const float*) (filhos + 4));
+    // Por faixa de 128 bits: [p0 p1 p4 p5 | p2 p3 p6 p7]; a permutação restaura a ordem
+    __m256i p = _mm256_castps_si256(_mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+    p = _mm256_permute4x64_epi64(p, _MM_SHUFFLE(3, 1, 2, 0));
+    __m256i m = _mm256_max_epi32(p, _mm256_shuffle_epi32(p, _MM_SHUFFLE(2, 3, 0, 1)));
+    m = _mm256_max_epi32(m, _mm256_shuffle_epi32(m, _MM_SHUFFLE(1, 0, 3, 2)));
+    m = _mm256_max_epi32(m, _mm256_permute2x128_si256(m, m, 1));
+    return bitMenosSignificativo((unsigned int) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(p, m))));
+#else
+    __m128i baixo = prioridades4(filhos);
+    __m128i alto = prioridades4(filhos + 4);
+    __m128i m = maxHorizontal4(maxEpi32(baixo, alto));
+    unsigned int mascara = (unsigned int) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(baixo, m)))
+                         | ((unsigned int) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(alto, m))) << 4);
+    return bitMenosSignificativo(mascara);
+#endif
+}
+
+#endif // DARY_SIMD
+
+/**
+ * @brief Encontra o filho de maior prioridade do grupo que começa em 'primeiro'.
+ * @return Índice absoluto do maior filho.
+ */
+static int maiorFilhoDary(const Paciente array[], int primeiro, int n) {
+#ifdef DARY_SIMD
+    if (primeiro + DARY_ARIDADE <= n) {
+        return primeiro + maiorFilhoSimd(&array[primeiro]);
+    }
+#endif
+    return maiorFilhoEscalar(array, primeiro, n);
+}
+
+/**
+ * @brief Antecipa a leitura dos netos de um nó: os filhos dos d filhos são
+ * d * d pacientes contíguos (d linhas de cache). Sem isso, a descida espera
+ * uma falta de cache por nível, pois a próxima linha só é conhecida depois
+ * da comparação; com ela, a linha do nível seguinte já está a caminho.
+ * @param netos Ponteiro para o primeiro neto.
+ */
+static void prefetchNetos(const Paciente *netos) {
+    const char *linha = (const char*) netos;
+    for (size_t l = 0; l < DARY_ARIDADE * DARY_ARIDADE * sizeof(Paciente); l += DARY_LINHA_CACHE) {
+#ifdef DARY_SIMD
+        _mm_prefetch(linha + l, _MM_HINT_T0);
+#elif defined(__GNUC__)
+        __builtin_prefetch(linha + l);
+#else
+        (void) linha;
+#endif
+    }
+}
+
+/**
+ * @brief Sobe o paciente da posição 'index' até sua posição correta.
+ * Usa um "buraco" que sobe: um único movimento por nível, sem trocas.
+ * @param heap Ponteiro para a DaryHeap.
+ * @param index Índice a partir do qual corrigir a heap.
+ */
+static void heapifyUpDary(DaryHeap *heap, int index) {
+    Paciente *array = heap->array;
+    Paciente p = array[index];
+    while (index > 0 && array[paiDary(index)].prioridade < p.prioridade) {
+        array[index] = array[paiDary(index)];
+        index = paiDary(index);
+    }
+    array[index] = p;
+}
+
+/**
+ * @brief Desce o paciente da posição 'index' até sua posição correta.
+ * @param heap Ponteiro para a DaryHeap.
+ * @param index Índice a partir do qual corrigir a heap.
+ */
+static void heapifyDownDary(DaryHeap *heap, int index) {
+    Paciente *array = heap->array;
+    int n = heap->tamanho;
+    Paciente p = array[index];
+    int primeiro;
+    while ((primeiro = primeiroFilhoDary(index)) < n) {
+        if (primeiroFilhoDary(primeiro) < n) {
+            prefetchNetos(&array[primeiroFilhoDary(primeiro)]);
+        }
+        int maior = maiorFilhoDary(array, primeiro, n);
+        if (array[maior].prioridade <= p.prioridade) {
+            break;
+        }
+        array[index] = array[maior];
+        index = maior;
+    }
+    array[index] = p;
+}
+
+/**
+ * @brief Aloca um bloco alinhado à linha de cache para 'capacidade' pacientes
+ * (mais o deslocamento) e copia os 'tamanho' primeiros do array antigo.
+ * @return HEAP_OK ou HEAP_ERRO_MEMORIA (o array original é preservado).
+ */
+static int redimensionarDary(DaryHeap *heap, int novaCapacidade) {
+    size_t posicoes = (size_t) (novaCapacidade > 0 ? novaCapacidade : 1) + DARY_DESLOCAMENTO;
+    void *bloco = malloc(posicoes * sizeof(Paciente) + DARY_LINHA_CACHE);
+    if (bloco == NULL) {
+        return HEAP_ERRO_MEMORIA;
+    }
+    uintptr_t alinhado = ((uintptr_t) bloco + DARY_LINHA_CACHE - 1) & ~(uintptr_t) (DARY_LINHA_CACHE - 1);
+    Paciente *array = (Paciente*) alinhado + DARY_DESLOCAMENTO;
+    if (heap->tamanho > 0) {
+        memcpy(array, heap->array, (size_t) heap->tamanho * sizeof(Paciente));
+    }
+    free(heap->bloco);
+    heap->bloco = bloco;
+    heap->array = array;
+    heap->capacidade = novaCapacidade;
+    return HEAP_OK;
+}
+
+// Implementações das funções públicas
+
+DaryHeap* criarDaryHeap(int capacidade) {
+    if (capacidade > DARY_CAPACIDADE_MAX) {
+        fprintf(stderr, "Capacidade grande demais para a DaryHeap (máximo %d)\n", DARY_CAPACIDADE_MAX);
+        return NULL;
+    }
+    DaryHeap *heap = (DaryHeap*) malloc(sizeof(DaryHeap));
+    if (heap == NULL) {
+        perror("Falha ao alocar memória para heap (DaryHeap)");
+        return NULL;
+    }
+    heap->array = NULL;
+    heap->bloco = NULL;
+    heap->tamanho = 0;
+    heap->expansivel = 0;
+    if (redimensionarDary(heap, capacidade > 0 ? capacidade : 0) != HEAP_OK) {
+        perror("Falha ao alocar memória para o array da heap (DaryHeap)");
+        free(heap);
+        return NULL;
+    }
+    return heap;
+}
+
+DaryHeap* criarDaryHeapExpansivel(int capacidadeInicial) {
+    DaryHeap *heap = criarDaryHeap(capacidadeInicial);
+    if (heap != NULL) {
+        heap->expansivel = 1;
+    }
+    return heap;
+}
+
+int inserirPacienteDary(DaryHeap *heap, Paciente p) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    if (heap->tamanho == heap->capacidade) {
+        if (!heap->expansivel || heap->capacidade >= DARY_CAPACIDADE_MAX) {
+            return HEAP_ERRO_CHEIA;
+        }
+        int nova = heap->capacidade < 8 ? 8
+                 : (heap->capacidade > DARY_CAPACIDADE_MAX / 2 ? DARY_CAPACIDADE_MAX : heap->capacidade * 2);
+        int status = redimensionarDary(heap, nova);
+        if (status != HEAP_OK) {
+            return status;
+        }
+    }
+    heap->array[heap->tamanho] = p;
+    heap->tamanho++;
+    heapifyUpDary(heap, heap->tamanho - 1);
+    return HEAP_OK;
+}
+
+Paciente extrairMaxPacienteDary(DaryHeap *heap) {
+    Paciente pVazio = {-1, -1};
+    if (heap == NULL || heap->tamanho <= 0) {
+        return pVazio;
+    }
+    Paciente raiz = heap->array[0];
+    heap->tamanho--;
+    if (heap->tamanho > 0) {
+        heap->array[0] = heap->array[heap->tamanho];
+        heapifyDownDary(heap, 0);
+    }
+    return raiz;
+}
+
+int daryHeapVazia(DaryHeap *heap) {
+    if (heap == NULL) return 1;
+    return heap->tamanho == 0;
+}
+
+void liberarDaryHeap(DaryHeap *heap) {
+    if (heap != NULL) {
+        free(heap->bloco);
+        free(heap);
+    }
+}
@@ -0,0 +1,78 @@
+#ifndef DARY_HEAP_H
+#define DARY_HEAP_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Aridade da heap (número de filhos por nó), escolhida em tempo de compilação.
+// Com Paciente de 8 bytes, 8 filhos ocupam exatamente uma linha de cache de 64 bytes.
+#ifndef DARY_ARIDADE
+#define DARY_ARIDADE 8
+#endif
+
+#if DARY_ARIDADE != 4 && DARY_ARIDADE != 8
+#error "DARY_ARIDADE deve ser 4 ou 8"
+#endif
+
+// Tamanho da linha de cache usada para alinhar o array
+#define DARY_LINHA_CACHE 64
+
+// Estrutura para a Max-Heap d-ária
+typedef struct {
+    Paciente *array; // Ponteiro para o array de pacientes (filhos de um nó alinhados à linha de cache)
+    void *bloco;     // Bloco alocado de fato (o array é deslocado dentro dele)
+    int tamanho;     // Número atual de pacientes na heap
+    int capacidade;  // Capacidade atual do array
+    int expansivel;  // 1 se o array cresce automaticamente quando cheio
+} DaryHeap;
+
+/**
+ * @brief Cria uma nova Max-Heap d-ária de capacidade fixa.
+ * O array é alinhado de forma que todos os filhos de um nó fiquem na mesma
+ * linha de cache.
+ * @param capacidade A capacidade máxima da heap (até (INT_MAX - 1) / DARY_ARIDADE).
+ * @return Ponteiro para a DaryHeap criada, ou NULL em caso de falha.
+ */
+DaryHeap* criarDaryHeap(int capacidade);
+
+/**
+ * @brief Cria uma nova Max-Heap d-ária expansível (capacidade dobrada quando cheia).
+ * @param capacidadeInicial Capacidade inicial do array (pode ser 0).
+ * @return Ponteiro para a DaryHeap criada, ou NULL em caso de falha.
+ */
+DaryHeap* criarDaryHeapExpansivel(int capacidadeInicial);
+
+/**
+ * @brief Insere um paciente na Max-Heap d-ária.
+ * @param heap Ponteiro para a DaryHeap.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_CHEIA, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacienteDary(DaryHeap *heap, Paciente p);
+
+/**
+ * @brief Extrai e retorna o paciente com a maior prioridade da Max-Heap d-ária.
+ * A escolha do maior filho em cada nível usa comparação vetorizada (SSE2/AVX2)
+ * quando disponível.
+ * @param heap Ponteiro para a DaryHeap.
+ * @return O Paciente com a maior prioridade. Se a heap estiver vazia,
+ * retorna um Paciente com id e prioridade -1.
+ */
+Paciente extrairMaxPacienteDary(DaryHeap *heap);
+
+/**
+ * @brief Verifica se a Max-Heap d-ária está vazia.
+ * @param heap Ponteiro para a DaryHeap.
+ * @return 1 se a heap estiver vazia, 0 caso contrário.
+ */
+int daryHeapVazia(DaryHeap *heap);
+
+/**
+ * @brief Libera a memória alocada para a Max-Heap d-ária.
+ * @param heap Ponteiro para a DaryHeap a ser liberada.
+ */
+void liberarDaryHeap(DaryHeap *heap);
+
+#endif // DARY_HEAP_H
@@ -0,0 +1,174 @@
+#include "fila_baldes.h"
+#include <string.h> // memcpy
+
+#ifdef _MSC_VER
+#include <intrin.h> // _BitScanForward64, _BitScanReverse64
+#endif
+
+// Funções auxiliares estáticas
+
+/**
+ * @brief Retorna a posição do bit menos significativo ligado de 'palavra' (não nula).
+ */
+static int primeiroBit(uint64_t palavra) {
+#ifdef _MSC_VER
+    unsigned long indice;
+    _BitScanForward64(&indice, palavra);
+    return (int) indice;
+#else
+    return __builtin_ctzll(palavra);
+#endif
+}
+
+/**
+ * @brief Retorna a posição do bit mais significativo ligado de 'palavra' (não nula).
+ */
+static int ultimoBit(uint64_t palavra) {
+#ifdef _MSC_VER
+    unsigned long indice;
+    _BitScanReverse64(&indice, palavra);
+    return (int) indice;
+#else
+    return 63 - __builtin_clzll(palavra);
+#endif
+}
+
+/**
+ * @brief Dobra a capacidade do balde, desenrolando o buffer circular.
+ * @return 1 em caso de sucesso, 0 se a memória não pôde ser alocada.
+ */
+static int crescerBalde(Balde *balde) {
+    int nova = balde->capacidade > 0 ? balde->capacidade * 2 : 4;
+    Paciente *itens = (Paciente*) malloc((size_t) nova * sizeof(Paciente));
+    if (itens == NULL) {
+        return 0;
+    }
+    int primeiros = balde->capacidade - balde->inicio;
+    if (primeiros > balde->quantidade) {
+        primeiros = balde->quantidade;
+    }
+    if (balde->quantidade > 0) {
+        memcpy(itens, balde->itens + balde->inicio, (size_t) primeiros * sizeof(Paciente));
+        memcpy(itens + primeiros, balde->itens, (size_t) (balde->quantidade - primeiros) * sizeof(Paciente));
+    }
+    free(balde->itens);
+    balde->itens = itens;
+    balde->inicio = 0;
+    balde->capacidade = nova;
+    return 1;
+}
+
+/**
+ * @brief Remove o paciente mais antigo do balde 'b', atualizando os mapas de
+ * bits se o balde esvaziar.
+ */
+static Paciente retirarDoBalde(FilaBaldes *fila, int b) {
+    Balde *balde = &fila->baldes[b];
+    Paciente p = balde->itens[balde->inicio];
+    balde->inicio = (balde->inicio + 1) & (balde->capacidade - 1);
+    balde->quantidade--;
+    fila->tamanho--;
+    if (balde->quantidade == 0) {
+        int w = b >> 6;
+        fila->mapa[w] &= ~((uint64_t) 1 << (b & 63));
+        if (fila->mapa[w] == 0) {
+            fila->resumo[w >> 6] &= ~((uint64_t) 1 << (w & 63));
+        }
+    }
+    return p;
+}
+
+FilaBaldes* criarFilaBaldes(int prioridadeMinima, int prioridadeMaxima) {
+    if (prioridadeMaxima < prioridadeMinima ||
+        (long long) prioridadeMaxima - prioridadeMinima + 1 > FILA_BALDES_MAX_NIVEIS) {
+        fprintf(stderr, "Faixa de prioridades inválida para FilaBaldes: [%d, %d]\n",
+                prioridadeMinima, prioridadeMaxima);
+        return NULL;
+    }
+    FilaBaldes *fila = (FilaBaldes*) malloc(sizeof(FilaBaldes));
+    if (fila == NULL) {
+        perror("Falha ao alocar memória para a fila (FilaBaldes)");
+        return NULL;
+    }
+    int niveis = prioridadeMaxima - prioridadeMinima + 1;
+    fila->prioridadeMinima = prioridadeMinima;
+    fila->prioridadeMaxima = prioridadeMaxima;
+    fila->numPalavras = (niveis + 63) / 64;
+    fila->numResumo = (fila->numPalavras + 63) / 64;
+    fila->tamanho = 0;
+    fila->baldes = (Balde*) calloc((size_t) niveis, sizeof(Balde));
+    fila->mapa = (uint64_t*) calloc((size_t) fila->numPalavras, sizeof(uint64_t));
+    fila->resumo = (uint64_t*) calloc((size_t) fila->numResumo, sizeof(uint64_t));
+    if (fila->baldes == NULL || fila->mapa == NULL || fila->resumo == NULL) {
+        perror("Falha ao alocar memória para os baldes (FilaBaldes)");
+        free(fila->baldes);
+        free(fila->mapa);
+        free(fila->resumo);
+        free(fila);
+        return NULL;
+    }
+    return fila;
+}
+
+int inserirPacienteBaldes(FilaBaldes *fila, Paciente p) {
+    if (fila == NULL || p.prioridade < fila->prioridadeMinima || p.prioridade > fila->prioridadeMaxima) {
+        return HEAP_ERRO_PARAMETRO;
+    }
+    int b = p.prioridade - fila->prioridadeMinima;
+    Balde *balde = &fila->baldes[b];
+    if (balde->quantidade == balde->capacidade && !crescerBalde(balde)) {
+        return HEAP_ERRO_MEMORIA;
+    }
+    balde->itens[(balde->inicio + balde->quantidade) & (balde->capacidade - 1)] = p;
+    balde->quantidade++;
+    fila->tamanho++;
+
+    int w = b >> 6;
+    fila->mapa[w] |= (uint64_t) 1 << (b & 63);
+    fila->resumo[w >> 6] |= (uint64_t) 1 << (w & 63);
+    return HEAP_OK;
+}
+
+Paciente extrairMaxPacienteBaldes(FilaBaldes *fila) {
+    Paciente pVazio = {-1, -1};
+    if (fila == NULL || fila->tamanho == 0) {
+        return pVazio;
+    }
+    int r = fila->numResumo - 1;
+    while (fila->resumo[r] == 0) {
+        r--;
+    }
+    int w = (r << 6) + ultimoBit(fila->resumo[r]);
+    return retirarDoBalde(fila, (w << 6) + ultimoBit(fila->mapa[w]));
+}
+
+Paciente extrairMinPacienteBaldes(FilaBaldes *fila) {
+    Paciente pVazio = {-1, -1};
+    if (fila == NULL || fila->tamanho == 0) {
+        return pVazio;
+    }
+    int r = 0;
+    while (fila->resumo[r] == 0) {
+        r++;
+    }
+    int w = (r << 6) + primeiroBit(fila->resumo[r]);
+    return retirarDoBalde(fila, (w << 6) + primeiroBit(fila->mapa[w]));
+}
+
+int filaBaldesVazia(FilaBaldes *fila) {
+    if (fila == NULL) return 1;
+    return fila->tamanho == 0;
+}
+
+void liberarFilaBaldes(FilaBaldes *fila) {
+    if (fila != NULL) {
+        int niveis = fila->prioridadeMaxima - fila->prioridadeMinima + 1;
+        for (int b = 0; b < niveis; b++) {
+            free(fila->baldes[b].itens);
+        }
+        free(fila->baldes);
+        free(fila->mapa);
+        free(fila->resumo);
+        free(fila);
+    }
+}
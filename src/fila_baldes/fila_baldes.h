@@ -0,0 +1,85 @@
+#ifndef FILA_BALDES_H
+#define FILA_BALDES_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include <stdint.h> // uint64_t
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Maior número de níveis de prioridade aceito por uma FilaBaldes
+#define FILA_BALDES_MAX_NIVEIS (1 << 24)
+
+// Lista FIFO (buffer circular) dos pacientes de uma mesma prioridade
+typedef struct {
+    Paciente *itens;
+    int inicio;     // Posição do paciente mais antigo
+    int quantidade; // Pacientes no balde
+    int capacidade; // Potência de 2 (ou 0)
+} Balde;
+
+// Fila de prioridade por baldes para faixas de prioridade pequenas e
+// conhecidas na criação: um balde FIFO por nível e um mapa de bits de dois
+// níveis dos baldes não vazios. Inserção e extração custam O(1) (para faixas
+// de até 4096 níveis, uma busca de bit em duas palavras de 64 bits).
+typedef struct {
+    Balde *baldes;         // Um balde por prioridade, de prioridadeMinima a prioridadeMaxima
+    uint64_t *mapa;        // Bit b ligado se o balde b não estiver vazio
+    uint64_t *resumo;      // Bit w ligado se mapa[w] não for zero
+    int prioridadeMinima;
+    int prioridadeMaxima;
+    int numPalavras;       // Palavras em 'mapa'
+    int numResumo;         // Palavras em 'resumo'
+    int tamanho;           // Número total de pacientes
+} FilaBaldes;
+
+/**
+ * @brief Cria uma fila por baldes para prioridades em [prioridadeMinima, prioridadeMaxima].
+ * @param prioridadeMinima Menor prioridade aceita.
+ * @param prioridadeMaxima Maior prioridade aceita (no máximo
+ * FILA_BALDES_MAX_NIVEIS níveis na faixa).
+ * @return Ponteiro para a FilaBaldes criada, ou NULL em caso de falha ou faixa inválida.
+ */
+FilaBaldes* criarFilaBaldes(int prioridadeMinima, int prioridadeMaxima);
+
+/**
+ * @brief Insere um paciente no fim do balde da sua prioridade em O(1) amortizado.
+ * @param fila Ponteiro para a FilaBaldes.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO (inclusive
+ * prioridade fora da faixa).
+ */
+int inserirPacienteBaldes(FilaBaldes *fila, Paciente p);
+
+/**
+ * @brief Extrai o paciente de maior prioridade; entre prioridades iguais,
+ * o que foi inserido primeiro.
+ * @param fila Ponteiro para a FilaBaldes.
+ * @return O Paciente extraído. Se a fila estiver vazia, retorna um Paciente
+ * com id e prioridade -1.
+ */
+Paciente extrairMaxPacienteBaldes(FilaBaldes *fila);
+
+/**
+ * @brief Extrai o paciente de menor prioridade; entre prioridades iguais,
+ * o que foi inserido primeiro.
+ * @param fila Ponteiro para a FilaBaldes.
+ * @return O Paciente extraído. Se a fila estiver vazia, retorna um Paciente
+ * com id e prioridade -1.
+ */
+Paciente extrairMinPacienteBaldes(FilaBaldes *fila);
+
+/**
+ * @brief Verifica se a fila por baldes está vazia.
+ * @param fila Ponteiro para a FilaBaldes.
+ * @return 1 se a fila estiver vazia, 0 caso contrário.
+ */
+int filaBaldesVazia(FilaBaldes *fila);
+
+/**
+ * @brief Libera a memória alocada para a fila por baldes.
+ * @param fila Ponteiro para a FilaBaldes a ser liberada.
+ */
+void liberarFilaBaldes(FilaBaldes *fila);
+
+#endif // FILA_BALDES_H
@@ -0,0 +1,257 @@
+#include "fila_concorrente.h"
+
+#if !defined(__GNUC__)
+#error "fila_concorrente requer GCC ou Clang (builtins __atomic e __thread)"
+#endif
+
+// Operações atômicas sobre int (sequencialmente consistentes: o protocolo de
+// espera depende de 'tamanho' e 'esperando' serem vistos em ordem total).
+#define ATOMICO_LER(p) __atomic_load_n((p), __ATOMIC_SEQ_CST)
+#define ATOMICO_GRAVAR(p, v) __atomic_store_n((p), (v), __ATOMIC_SEQ_CST)
+#define ATOMICO_SOMAR(p, v) __atomic_add_fetch((p), (v), __ATOMIC_SEQ_CST)
+// O topo e a ocupação de cada fila interna são só dicas para a escolha; leitura relaxada basta
+#define ATOMICO_LER_DICA(p) __atomic_load_n((p), __ATOMIC_RELAXED)
+#define ATOMICO_GRAVAR_DICA(p, v) __atomic_store_n((p), (v), __ATOMIC_RELAXED)
+
+// Tentativas com trylock antes de recorrer à varredura bloqueante
+#define FILA_CONCORRENTE_TENTATIVAS 8
+
+// Estado do gerador aleatório de cada thread
+static __thread unsigned int estadoAleatorio;
+static unsigned int sementeGlobal = 0x9E3779B9u;
+
+// Funções auxiliares estáticas
+
+/**
+ * @brief Gera um número pseudoaleatório (xorshift32) local à thread.
+ */
+static unsigned int aleatorioThread(void) {
+    unsigned int x = estadoAleatorio;
+    if (x == 0) {
+        // Primeira chamada na thread: semente distinta por thread
+        x = __atomic_add_fetch(&sementeGlobal, 0x9E3779B9u, __ATOMIC_RELAXED) | 1u;
+    }
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    estadoAleatorio = x;
+    return x;
+}
+
+/**
+ * @brief Atualiza a dica de topo da fila interna. Deve ser chamada com a trava.
+ */
+static void atualizarTopo(FilaInterna *interna) {
+    int ocupada = !maxHeapVazia(interna->heap);
+    if (ocupada) {
+        ATOMICO_GRAVAR_DICA(&interna->topo, interna->heap->array[0].prioridade);
+    }
+    ATOMICO_GRAVAR_DICA(&interna->ocupada, ocupada);
+}
+
+/**
+ * @brief Escolhe a mais urgente de duas filas internas pelas dicas; uma fila
+ * vazia só é escolhida se as duas estiverem vazias.
+ */
+static FilaInterna* melhorDeDuas(FilaInterna *a, FilaInterna *b) {
+    if (!ATOMICO_LER_DICA(&b->ocupada)) return a;
+    if (!ATOMICO_LER_DICA(&a->ocupada)) return b;
+    return ATOMICO_LER_DICA(&a->topo) >= ATOMICO_LER_DICA(&b->topo) ? a : b;
+}
+
+/**
+ * @brief Extrai até k pacientes de uma fila interna já travada.
+ * @return Número de pacientes extraídos.
+ */
+static int extrairDaInterna(FilaConcorrente *fila, FilaInterna *interna, Paciente saida[], int k) {
+    int extraidos = 0;
+    while (extraidos < k && !maxHeapVazia(interna->heap)) {
+        saida[extraidos++] = extrairMaxPacienteHeap(interna->heap);
+    }
+    if (extraidos > 0) {
+        atualizarTopo(interna);
+        ATOMICO_SOMAR(&fila->tamanho, -extraidos);
+    }
+    return extraidos;
+}
+
+/**
+ * @brief Extração sem bloqueio: melhor de duas filas internas aleatórias e,
+ * se falhar repetidamente, varredura de todas as filas internas.
+ * @return Número de pacientes extraídos (0 se a fila estava vazia).
+ */
+static int extrairRelaxado(FilaConcorrente *fila, Paciente saida[], int k) {
+    for (int tentativa = 0; tentativa < FILA_CONCORRENTE_TENTATIVAS; tentativa++) {
+        if (ATOMICO_LER(&fila->tamanho) <= 0) {
+            return 0;
+        }
+        FilaInterna *a = &fila->filas[aleatorioThread() % (unsigned int) fila->numFilas];
+        FilaInterna *b = &fila->filas[aleatorioThread() % (unsigned int) fila->numFilas];
+        FilaInterna *melhor = melhorDeDuas(a, b);
+        if (!ATOMICO_LER_DICA(&melhor->ocupada)) {
+            continue;
+        }
+        if (pthread_mutex_trylock(&melhor->trava) != 0) {
+            continue;
+        }
+        int extraidos = extrairDaInterna(fila, melhor, saida, k);
+        pthread_mutex_unlock(&melhor->trava);
+        if (extraidos > 0) {
+            return extraidos;
+        }
+    }
+
+    // Poucos pacientes espalhados ou muita contenção: varre todas as filas internas
+    int inicio = (int) (aleatorioThread() % (unsigned int) fila->numFilas);
+    for (int i = 0; i < fila->numFilas; i++) {
+        FilaInterna *interna = &fila->filas[(inicio + i) % fila->numFilas];
+        if (!ATOMICO_LER_DICA(&interna->ocupada)) {
+            continue;
+        }
+        pthread_mutex_lock(&interna->trava);
+        int extraidos = extrairDaInterna(fila, interna, saida, k);
+        pthread_mutex_unlock(&interna->trava);
+        if (extraidos > 0) {
+            return extraidos;
+        }
+    }
+    return 0;
+}
+
+// Implementações das funções públicas
+
+FilaConcorrente* criarFilaConcorrente(int numFilas, int capacidadeInicial) {
+    if (numFilas <= 0) return NULL;
+    FilaConcorrente *fila = (FilaConcorrente*) malloc(sizeof(FilaConcorrente));
+    if (fila == NULL) {
+        perror("Falha ao alocar memória para a fila concorrente");
+        return NULL;
+    }
+    fila->filas = (FilaInterna*) calloc((size_t) numFilas, sizeof(FilaInterna));
+    if (fila->filas == NULL) {
+        perror("Falha ao alocar memória para as filas internas");
+        free(fila);
+        return NULL;
+    }
+    fila->numFilas = numFilas;
+    fila->tamanho = 0;
+    fila->esperando = 0;
+    fila->fechada = 0;
+    pthread_mutex_init(&fila->travaEspera, NULL);
+    pthread_cond_init(&fila->naoVazia, NULL);
+
+    for (int i = 0; i < numFilas; i++) {
+        FilaInterna *interna = &fila->filas[i];
+        interna->heap = criarMaxHeapExpansivel(capacidadeInicial);
+        if (interna->heap == NULL) {
+            fila->numFilas = i; // Libera apenas as já criadas
+            liberarFilaConcorrente(fila);
+            return NULL;
+        }
+        pthread_mutex_init(&interna->trava, NULL);
+        interna->topo = 0;
+        interna->ocupada = 0;
+    }
+    return fila;
+}
+
+int inserirPacienteConcorrente(FilaConcorrente *fila, Paciente p) {
+    if (fila == NULL) return HEAP_ERRO_PARAMETRO;
+
+    FilaInterna *interna = NULL;
+    for (int tentativa = 0; tentativa < FILA_CONCORRENTE_TENTATIVAS; tentativa++) {
+        FilaInterna *candidata = &fila->filas[aleatorioThread() % (unsigned int) fila->numFilas];
+        if (pthread_mutex_trylock(&candidata->trava) == 0) {
+            interna = candidata;
+            break;
+        }
+    }
+    if (interna == NULL) {
+        interna = &fila->filas[aleatorioThread() % (unsigned int) fila->numFilas];
+        pthread_mutex_lock(&interna->trava);
+    }
+
+    int status = inserirPacienteMax(interna->heap, p);
+    if (status == HEAP_OK && (!interna->ocupada || p.prioridade >= interna->topo)) {
+        atualizarTopo(interna);
+    }
+    pthread_mutex_unlock(&interna->trava);
+    if (status != HEAP_OK) {
+        return status;
+    }
+
+    ATOMICO_SOMAR(&fila->tamanho, 1);
+    if (ATOMICO_LER(&fila->esperando) > 0) {
+        pthread_mutex_lock(&fila->travaEspera);
+        pthread_cond_signal(&fila->naoVazia);
+        pthread_mutex_unlock(&fila->travaEspera);
+    }
+    return HEAP_OK;
+}
+
+int tentarExtrairMaxConcorrente(FilaConcorrente *fila, Paciente *saida) {
+    if (fila == NULL || saida == NULL) return 0;
+    return extrairRelaxado(fila, saida, 1);
+}
+
+Paciente extrairMaxConcorrente(FilaConcorrente *fila) {
+    Paciente pVazio = {-1, -1};
+    Paciente p;
+    if (fila == NULL) return pVazio;
+
+    for (;;) {
+        if (extrairRelaxado(fila, &p, 1) == 1) {
+            return p;
+        }
+        pthread_mutex_lock(&fila->travaEspera);
+        ATOMICO_SOMAR(&fila->esperando, 1);
+        while (ATOMICO_LER(&fila->tamanho) <= 0 && !ATOMICO_LER(&fila->fechada)) {
+            pthread_cond_wait(&fila->naoVazia, &fila->travaEspera);
+        }
+        ATOMICO_SOMAR(&fila->esperando, -1);
+        int encerrar = ATOMICO_LER(&fila->tamanho) <= 0 && ATOMICO_LER(&fila->fechada);
+        pthread_mutex_unlock(&fila->travaEspera);
+        if (encerrar) {
+            return pVazio;
+        }
+    }
+}
+
+int extrairLoteConcorrente(FilaConcorrente *fila, Paciente saida[], int k) {
+    if (fila == NULL || saida == NULL || k <= 0) return 0;
+    int total = 0;
+    while (total < k) {
+        int extraidos = extrairRelaxado(fila, saida + total, k - total);
+        if (extraidos == 0) {
+            break;
+        }
+        total += extraidos;
+    }
+    return total;
+}
+
+int filaConcorrenteVazia(FilaConcorrente *fila) {
+    if (fila == NULL) return 1;
+    return ATOMICO_LER(&fila->tamanho) <= 0;
+}
+
+void fecharFilaConcorrente(FilaConcorrente *fila) {
+    if (fila == NULL) return;
+    pthread_mutex_lock(&fila->travaEspera);
+    ATOMICO_GRAVAR(&fila->fechada, 1);
+    pthread_cond_broadcast(&fila->naoVazia);
+    pthread_mutex_unlock(&fila->travaEspera);
+}
+
+void liberarFilaConcorrente(FilaConcorrente *fila) {
+    if (fila != NULL) {
+        for (int i = 0; i < fila->numFilas; i++) {
+            pthread_mutex_destroy(&fila->filas[i].trava);
+            liberarMaxHeap(fila->filas[i].heap);
+        }
+        pthread_mutex_destroy(&fila->travaEspera);
+        pthread_cond_destroy(&fila->naoVazia);
+        free(fila->filas);
+        free(fila);
+    }
+}
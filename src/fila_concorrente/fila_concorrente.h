@@ -0,0 +1,94 @@
+#ifndef FILA_CONCORRENTE_H
+#define FILA_CONCORRENTE_H
+
+#include <pthread.h>
+#include "max_heap/max_heap.h" // MaxHeap usada em cada fila interna
+
+// Tamanho da linha de cache, para evitar falso compartilhamento entre filas internas
+#define FILA_CONCORRENTE_LINHA_CACHE 64
+
+// Uma fila interna (shard): uma MaxHeap protegida por sua própria trava
+typedef struct {
+    pthread_mutex_t trava; // Protege 'heap'
+    MaxHeap *heap;         // Max-Heap expansível com os pacientes desta fila interna
+    int topo;              // Prioridade da raiz (válida só se 'ocupada'), lida sem trava
+    int ocupada;           // 1 se a heap tem pacientes, lida sem trava junto com 'topo'
+    char preenchimento[FILA_CONCORRENTE_LINHA_CACHE]; // Separa filas internas vizinhas
+} FilaInterna;
+
+// Fila de prioridade concorrente relaxada (MultiQueue): várias Max-Heaps
+// independentes; a inserção usa uma fila interna aleatória e a extração
+// escolhe a melhor de duas filas internas aleatórias. O paciente extraído é
+// quase sempre um dos mais urgentes, mas não necessariamente o mais urgente.
+typedef struct {
+    FilaInterna *filas;       // Array de filas internas
+    int numFilas;             // Número de filas internas
+    int tamanho;              // Total de pacientes (acesso atômico)
+    int esperando;            // Consumidores bloqueados (acesso atômico)
+    int fechada;              // 1 após fecharFilaConcorrente
+    pthread_mutex_t travaEspera; // Usada apenas com 'naoVazia'
+    pthread_cond_t naoVazia;  // Sinaliza consumidores bloqueados
+} FilaConcorrente;
+
+/**
+ * @brief Cria uma nova fila de prioridade concorrente.
+ * @param numFilas Número de filas internas; recomenda-se ao menos 2x o número
+ * de threads que acessam a fila.
+ * @param capacidadeInicial Capacidade inicial de cada fila interna (expansível).
+ * @return Ponteiro para a FilaConcorrente criada, ou NULL em caso de falha.
+ */
+FilaConcorrente* criarFilaConcorrente(int numFilas, int capacidadeInicial);
+
+/**
+ * @brief Insere um paciente em uma fila interna aleatória. Seguro entre threads.
+ * @param fila Ponteiro para a FilaConcorrente.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacienteConcorrente(FilaConcorrente *fila, Paciente p);
+
+/**
+ * @brief Extrai um dos pacientes mais urgentes sem bloquear.
+ * @param fila Ponteiro para a FilaConcorrente.
+ * @param saida Recebe o paciente extraído.
+ * @return 1 se um paciente foi extraído, 0 se a fila estava vazia.
+ */
+int tentarExtrairMaxConcorrente(FilaConcorrente *fila, Paciente *saida);
+
+/**
+ * @brief Extrai um dos pacientes mais urgentes, bloqueando enquanto a fila
+ * estiver vazia.
+ * @param fila Ponteiro para a FilaConcorrente.
+ * @return O Paciente extraído. Se a fila for fechada e estiver vazia, retorna
+ * um Paciente com id e prioridade -1.
+ */
+Paciente extrairMaxConcorrente(FilaConcorrente *fila);
+
+/**
+ * @brief Extrai até k pacientes urgentes sem bloquear, adquirindo poucas travas
+ * (os pacientes são retirados em sequência da melhor fila interna escolhida).
+ * @param fila Ponteiro para a FilaConcorrente.
+ * @param saida Array que recebe os pacientes extraídos.
+ * @param k Número máximo de pacientes a extrair.
+ * @return Número de pacientes extraídos.
+ */
+int extrairLoteConcorrente(FilaConcorrente *fila, Paciente saida[], int k);
+
+/**
+ * @brief Retorna (de forma aproximada sob concorrência) se a fila está vazia.
+ */
+int filaConcorrenteVazia(FilaConcorrente *fila);
+
+/**
+ * @brief Fecha a fila: consumidores bloqueados em extrairMaxConcorrente
+ * retornam assim que ela esvaziar.
+ */
+void fecharFilaConcorrente(FilaConcorrente *fila);
+
+/**
+ * @brief Libera a fila. Nenhuma thread pode estar usando-a.
+ * @param fila Ponteiro para a FilaConcorrente a ser liberada.
+ */
+void liberarFilaConcorrente(FilaConcorrente *fila);
+
+#endif // FILA_CONCORRENTE_H
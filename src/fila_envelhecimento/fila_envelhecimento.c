@@ -0,0 +1,309 @@
+#include "fila_envelhecimento.h"
+#include "heap_generico/heap_generico.h"
+
+// Uma Max-Heap por segmento, pela chave invariante no tempo
+#define ENTRADA_ENVELHECIMENTO_MAIOR(a, b) ((a).chave > (b).chave)
+HEAP_GERAR(heapSegmento, HeapSegmento, EntradaEnvelhecimento, ENTRADA_ENVELHECIMENTO_MAIOR)
+
+// Abaixo deste tamanho, a heap de um segmento não é compactada
+#define ENVELHECIMENTO_MINIMO_COMPACTAR 64
+
+/**
+ * @brief Chave de um paciente no segmento s: prioridade efetiva menos
+ * taxa * relógio, que é a mesma para qualquer instante dentro do segmento.
+ */
+static long long chaveSegmento(const FilaEnvelhecimento *fila, int s, int base, long long chegada) {
+    return (long long) base + fila->base[s] - (long long) fila->curva[s].taxa * (chegada + fila->curva[s].idadeInicial);
+}
+
+static int entradaValida(const FilaEnvelhecimento *fila, int s, const EntradaEnvelhecimento *e) {
+    const RegistroEnvelhecimento *r = &fila->registros[e->ref.indice];
+    return r->geracao == e->ref.geracao && r->segmento == s;
+}
+
+/**
+ * @brief Remove as entradas obsoletas da heap do segmento s e a reconstrói
+ * (Floyd). Chamada quando elas passam da metade da heap, o que mantém o custo
+ * amortizado em O(1) por migração.
+ */
+static void compactarSegmento(FilaEnvelhecimento *fila, int s) {
+    HeapSegmento *h = &fila->heaps[s];
+    int n = 0;
+    for (int i = 0; i < h->tamanho; i++) {
+        if (entradaValida(fila, s, &h->array[i])) {
+            h->array[n++] = h->array[i];
+        }
+    }
+    h->tamanho = n;
+    h->obsoletas = 0;
+    heapSegmentoConstruir(h->array, n);
+}
+
+// Segmento da curva para um paciente que espera há 'idade' tiques
+static int segmentoDaIdade(const FilaEnvelhecimento *fila, long long idade) {
+    int s = 0;
+    while (s + 1 < fila->numSegmentos && idade >= fila->curva[s + 1].idadeInicial) {
+        s++;
+    }
+    return s;
+}
+
+/**
+ * @brief Migra, em ordem de chegada, os pacientes que cruzaram o início de um
+ * segmento em que a taxa aumenta. Nesses limites a chave do segmento anterior
+ * subestimaria a prioridade, então a migração não pode esperar o paciente
+ * chegar à raiz. Processa os limites do primeiro ao último, de modo que um
+ * paciente que pulou vários segmentos os atravessa todos nesta chamada.
+ */
+static void migrarAcelerados(FilaEnvelhecimento *fila) {
+    for (int s = 1; s < fila->numSegmentos; s++) {
+        if (!fila->acelera[s]) {
+            continue;
+        }
+        long long limite = fila->curva[s].idadeInicial;
+        while (fila->cursor[s] < fila->fimChegadas) {
+            ReferenciaEnvelhecimento ref = fila->chegadas[fila->cursor[s]];
+            RegistroEnvelhecimento *r = &fila->registros[ref.indice];
+            if (r->geracao != ref.geracao || r->segmento >= s) {
+                fila->cursor[s]++; // Já foi atendido ou já migrou pela raiz
+                continue;
+            }
+            if (fila->relogio - r->chegada < limite) {
+                break;
+            }
+            EntradaEnvelhecimento e = {chaveSegmento(fila, s, r->paciente.prioridade, r->chegada), ref};
+            if (heapSegmentoInserir(&fila->heaps[s], e) != HEAP_OK) {
+                return; // Tenta de novo na próxima consulta
+            }
+            HeapSegmento *origem = &fila->heaps[r->segmento];
+            int anterior = r->segmento;
+            r->segmento = s;
+            fila->cursor[s]++;
+            origem->obsoletas++;
+            if (origem->tamanho >= ENVELHECIMENTO_MINIMO_COMPACTAR && origem->obsoletas > origem->tamanho / 2) {
+                compactarSegmento(fila, anterior);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Retorna o segmento cuja raiz tem a maior prioridade efetiva (-1 se
+ * vazia). Entre dois limites sem aumento de taxa, a chave do segmento em que
+ * o paciente está superestima a prioridade de quem já cruzou o limite, então
+ * basta corrigir (re-chavear no segmento certo) a raiz vencedora enquanto ela
+ * estiver atrasada: cada correção é O(log n) e acontece no máximo uma vez por
+ * limite para cada paciente. No empate, vence o segmento mais avançado.
+ */
+static int segmentoDoMaximo(FilaEnvelhecimento *fila, long long *efetivaMaxima) {
+    migrarAcelerados(fila);
+    for (;;) {
+        int melhor = -1;
+        long long maior = 0;
+        for (int s = 0; s < fila->numSegmentos; s++) {
+            HeapSegmento *h = &fila->heaps[s];
+            EntradaEnvelhecimento descartada;
+            while (h->tamanho > 0 && !entradaValida(fila, s, &h->array[0])) {
+                heapSegmentoExtrair(h, &descartada);
+                h->obsoletas--;
+            }
+            if (h->tamanho == 0) {
+                continue;
+            }
+            long long efetiva = h->array[0].chave + (long long) fila->curva[s].taxa * fila->relogio;
+            if (melhor < 0 || efetiva >= maior) {
+                melhor = s;
+                maior = efetiva;
+            }
+        }
+        if (melhor >= 0) {
+            EntradaEnvelhecimento raiz = fila->heaps[melhor].array[0];
+            RegistroEnvelhecimento *r = &fila->registros[raiz.ref.indice];
+            int destino = segmentoDaIdade(fila, fila->relogio - r->chegada);
+            if (destino > melhor) {
+                EntradaEnvelhecimento e = {chaveSegmento(fila, destino, r->paciente.prioridade, r->chegada), raiz.ref};
+                if (heapSegmentoInserir(&fila->heaps[destino], e) == HEAP_OK &&
+                    heapSegmentoExtrair(&fila->heaps[melhor], &raiz)) {
+                    r->segmento = destino;
+                    continue;
+                }
+                // Sem memória: usa a estimativa e tenta corrigir na próxima consulta
+            }
+        }
+        if (efetivaMaxima != NULL) {
+            *efetivaMaxima = maior;
+        }
+        return melhor;
+    }
+}
+
+FilaEnvelhecimento* criarFilaEnvelhecimento(const SegmentoEnvelhecimento curva[], int numSegmentos) {
+    if (curva == NULL || numSegmentos < 1 || numSegmentos > FILA_ENVELHECIMENTO_MAX_SEGMENTOS ||
+        curva[0].idadeInicial != 0) {
+        return NULL;
+    }
+    for (int s = 0; s < numSegmentos; s++) {
+        if (curva[s].taxa < 0 || (s > 0 && curva[s].idadeInicial <= curva[s - 1].idadeInicial)) {
+            return NULL;
+        }
+    }
+    FilaEnvelhecimento *fila = (FilaEnvelhecimento*) calloc(1, sizeof(FilaEnvelhecimento));
+    if (fila == NULL) {
+        perror("Falha ao alocar memória para a fila (FilaEnvelhecimento)");
+        return NULL;
+    }
+    fila->numSegmentos = numSegmentos;
+    fila->livre = -1;
+    for (int s = 0; s < numSegmentos; s++) {
+        fila->curva[s] = curva[s];
+        fila->base[s] = s == 0 ? 0
+                      : fila->base[s - 1] + (long long) curva[s - 1].taxa *
+                                            (curva[s].idadeInicial - curva[s - 1].idadeInicial);
+        if (s > 0 && curva[s].taxa > curva[s - 1].taxa) {
+            fila->acelera[s] = 1;
+            fila->ultimoAcelerado = s;
+        }
+        if (heapSegmentoInicializar(&fila->heaps[s], 0, 1) != HEAP_OK) {
+            perror("Falha ao alocar memória para as heaps (FilaEnvelhecimento)");
+            liberarFilaEnvelhecimento(fila);
+            return NULL;
+        }
+    }
+    return fila;
+}
+
+long long prioridadeEfetivaEnvelhecimento(const FilaEnvelhecimento *fila, int base, long long idade) {
+    int s = segmentoDaIdade(fila, idade);
+    return (long long) base + fila->base[s] + (long long) fila->curva[s].taxa * (idade - fila->curva[s].idadeInicial);
+}
+
+int avancarRelogioEnvelhecimento(FilaEnvelhecimento *fila, long long agora) {
+    if (fila == NULL || agora < fila->relogio) return HEAP_ERRO_PARAMETRO;
+    fila->relogio = agora;
+    return HEAP_OK;
+}
+
+// Garante espaço para mais uma chegada, descartando antes o prefixo já migrado
+static int garantirChegada(FilaEnvelhecimento *fila) {
+    if (fila->fimChegadas < fila->capacidadeChegadas) {
+        return HEAP_OK;
+    }
+    int descartar = fila->cursor[fila->ultimoAcelerado];
+    if (descartar > fila->capacidadeChegadas / 2) {
+        memmove(fila->chegadas, fila->chegadas + descartar,
+                (size_t) (fila->fimChegadas - descartar) * sizeof(ReferenciaEnvelhecimento));
+        fila->fimChegadas -= descartar;
+        for (int s = 1; s < fila->numSegmentos; s++) {
+            fila->cursor[s] -= descartar;
+        }
+        return HEAP_OK;
+    }
+    if (fila->capacidadeChegadas > INT_MAX / 2) return HEAP_ERRO_CHEIA;
+    int nova = fila->capacidadeChegadas < 16 ? 16 : fila->capacidadeChegadas * 2;
+    ReferenciaEnvelhecimento *novo = (ReferenciaEnvelhecimento*)
+        realloc(fila->chegadas, (size_t) nova * sizeof(ReferenciaEnvelhecimento));
+    if (novo == NULL) return HEAP_ERRO_MEMORIA;
+    fila->chegadas = novo;
+    fila->capacidadeChegadas = nova;
+    return HEAP_OK;
+}
+
+// Retorna o índice de um slot livre (-1 se faltar memória)
+static int alocarRegistro(FilaEnvelhecimento *fila) {
+    if (fila->livre < 0) {
+        if (fila->capacidadeRegistros > INT_MAX / 2) return -1;
+        int anterior = fila->capacidadeRegistros;
+        int nova = anterior < 16 ? 16 : anterior * 2;
+        RegistroEnvelhecimento *novo = (RegistroEnvelhecimento*)
+            realloc(fila->registros, (size_t) nova * sizeof(RegistroEnvelhecimento));
+        if (novo == NULL) return -1;
+        fila->registros = novo;
+        fila->capacidadeRegistros = nova;
+        for (int i = nova - 1; i >= anterior; i--) {
+            fila->registros[i].segmento = -1;
+            fila->registros[i].geracao = 0;
+            fila->registros[i].proximoLivre = fila->livre;
+            fila->livre = i;
+        }
+    }
+    int indice = fila->livre;
+    fila->livre = fila->registros[indice].proximoLivre;
+    return indice;
+}
+
+static void liberarRegistro(FilaEnvelhecimento *fila, int indice) {
+    RegistroEnvelhecimento *r = &fila->registros[indice];
+    r->segmento = -1;
+    r->geracao++; // Invalida as referências que ainda apontam para o slot
+    r->proximoLivre = fila->livre;
+    fila->livre = indice;
+}
+
+int inserirPacienteEnvelhecimento(FilaEnvelhecimento *fila, Paciente p) {
+    if (fila == NULL) return HEAP_ERRO_PARAMETRO;
+    if (fila->ultimoAcelerado > 0) {
+        int status = garantirChegada(fila);
+        if (status != HEAP_OK) return status;
+    }
+    int indice = alocarRegistro(fila);
+    if (indice < 0) return HEAP_ERRO_MEMORIA;
+    RegistroEnvelhecimento *r = &fila->registros[indice];
+    ReferenciaEnvelhecimento ref = {indice, r->geracao};
+    EntradaEnvelhecimento e = {chaveSegmento(fila, 0, p.prioridade, fila->relogio), ref};
+    int status = heapSegmentoInserir(&fila->heaps[0], e);
+    if (status != HEAP_OK) {
+        liberarRegistro(fila, indice);
+        return status;
+    }
+    r->paciente = p;
+    r->chegada = fila->relogio;
+    r->segmento = 0;
+    if (fila->ultimoAcelerado > 0) {
+        fila->chegadas[fila->fimChegadas++] = ref;
+    }
+    fila->tamanho++;
+    return HEAP_OK;
+}
+
+Paciente espiarMaxPacienteEnvelhecimento(FilaEnvelhecimento *fila, long long *prioridadeEfetiva) {
+    Paciente pVazio = {-1, -1};
+    if (fila == NULL || fila->tamanho == 0) {
+        return pVazio;
+    }
+    int s = segmentoDoMaximo(fila, prioridadeEfetiva);
+    if (s < 0 || fila->heaps[s].tamanho == 0) {
+        return pVazio;
+    }
+    return fila->registros[fila->heaps[s].array[0].ref.indice].paciente;
+}
+
+Paciente extrairMaxPacienteEnvelhecimento(FilaEnvelhecimento *fila, long long *prioridadeEfetiva) {
+    Paciente pVazio = {-1, -1};
+    if (fila == NULL || fila->tamanho == 0) {
+        return pVazio;
+    }
+    int s = segmentoDoMaximo(fila, prioridadeEfetiva);
+    EntradaEnvelhecimento raiz;
+    if (s < 0 || !heapSegmentoExtrair(&fila->heaps[s], &raiz)) {
+        return pVazio;
+    }
+    Paciente p = fila->registros[raiz.ref.indice].paciente;
+    liberarRegistro(fila, raiz.ref.indice);
+    fila->tamanho--;
+    return p;
+}
+
+int filaEnvelhecimentoVazia(const FilaEnvelhecimento *fila) {
+    return fila == NULL || fila->tamanho == 0;
+}
+
+void liberarFilaEnvelhecimento(FilaEnvelhecimento *fila) {
+    if (fila != NULL) {
+        for (int s = 0; s < fila->numSegmentos; s++) {
+            free(fila->heaps[s].array);
+        }
+        free(fila->registros);
+        free(fila->chegadas);
+        free(fila);
+    }
+}
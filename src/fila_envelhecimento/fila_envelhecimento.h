@@ -0,0 +1,164 @@
+#ifndef FILA_ENVELHECIMENTO_H
+#define FILA_ENVELHECIMENTO_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include <stdint.h> // uint32_t
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Fila de prioridade com envelhecimento: a prioridade efetiva de um paciente
+// é a prioridade base mais uma função crescente do tempo de espera, contra um
+// relógio global em unidades inteiras ("tiques") definidas por quem usa.
+//
+// A curva de envelhecimento é linear por partes: o segmento s começa na idade
+// idadeInicial[s] e soma 'taxa' pontos por tique (taxa 0 no último segmento
+// dá um teto). Dentro de um segmento, a prioridade efetiva no instante t é
+//     base + F(inicio do segmento) + taxa * (t - chegada - inicio do segmento)
+// e a ordem entre dois pacientes do mesmo segmento não depende de t: cada
+// segmento guarda os pacientes em uma Max-Heap pela chave invariante
+//     base + F(inicio) - taxa * (chegada + inicio)
+// e nada precisa ser reconstruído quando o relógio avança. Quando um paciente
+// cruza o início do próximo segmento, ele é re-chaveado de forma preguiçosa:
+// - se a taxa não aumenta (ex.: teto), a chave antiga superestima a
+//   prioridade e o paciente só é movido quando chega à raiz da sua heap;
+// - se a taxa aumenta, ele é movido na próxima consulta, em ordem de chegada,
+//   e a entrada antiga fica na heap de origem até ser descartada na raiz.
+
+// Máximo de segmentos da curva de envelhecimento
+#define FILA_ENVELHECIMENTO_MAX_SEGMENTOS 8
+
+// Um trecho da curva: a partir de 'idadeInicial' tiques de espera, soma
+// 'taxa' pontos de prioridade por tique
+typedef struct {
+    long long idadeInicial; // 0 no primeiro segmento; estritamente crescente
+    int taxa;               // >= 0
+} SegmentoEnvelhecimento;
+
+// Registro de um paciente na fila (slot reaproveitável)
+typedef struct {
+    Paciente paciente;
+    long long chegada;  // Relógio no momento da inserção
+    int segmento;       // Segmento atual da curva (-1 se o slot está livre)
+    int proximoLivre;   // Próximo slot da lista de livres
+    uint32_t geracao;   // Incrementada quando o slot é liberado
+} RegistroEnvelhecimento;
+
+// Referência a um registro: vale enquanto a geração do slot não mudar
+typedef struct {
+    int indice;
+    uint32_t geracao;
+} ReferenciaEnvelhecimento;
+
+// Entrada das heaps dos segmentos
+typedef struct {
+    long long chave; // Chave invariante no tempo dentro do segmento
+    ReferenciaEnvelhecimento ref;
+} EntradaEnvelhecimento;
+
+// Max-Heap de um segmento (campos esperados pelo motor genérico)
+typedef struct {
+    EntradaEnvelhecimento *array;
+    int tamanho;
+    int capacidade;
+    int expansivel;
+    int obsoletas; // Entradas de pacientes que já migraram para outro segmento
+} HeapSegmento;
+
+// Estrutura da fila com envelhecimento
+typedef struct {
+    SegmentoEnvelhecimento curva[FILA_ENVELHECIMENTO_MAX_SEGMENTOS];
+    long long base[FILA_ENVELHECIMENTO_MAX_SEGMENTOS]; // F(idadeInicial[s])
+    HeapSegmento heaps[FILA_ENVELHECIMENTO_MAX_SEGMENTOS];
+    int numSegmentos;
+    long long relogio;
+
+    RegistroEnvelhecimento *registros; // Slots dos pacientes
+    int capacidadeRegistros;
+    int livre;                          // Início da lista de slots livres (-1 se vazia)
+
+    // Pacientes em ordem de chegada (só se algum limite aumenta a taxa);
+    // chegadas[cursor[s]] é o próximo a cruzar o início do segmento s. Os
+    // cursores são decrescentes em s e tudo antes do último é descartado.
+    int acelera[FILA_ENVELHECIMENTO_MAX_SEGMENTOS]; // 1 se taxa[s] > taxa[s - 1]
+    int ultimoAcelerado;                            // Último s com acelera[s] (0 se nenhum)
+    ReferenciaEnvelhecimento *chegadas;
+    int fimChegadas;
+    int capacidadeChegadas;
+    int cursor[FILA_ENVELHECIMENTO_MAX_SEGMENTOS];
+
+    int tamanho; // Pacientes na fila
+} FilaEnvelhecimento;
+
+/**
+ * @brief Cria uma fila com envelhecimento para a curva dada. Exemplo:
+ * {{0, 1}, {50, 0}} soma 1 ponto por tique até 50 tiques de espera e fica
+ * constante depois (teto de 50 pontos). Um único segmento ({{0, taxa}}) é
+ * envelhecimento linear puro, sem migrações. O relógio começa em 0.
+ * @param curva Segmentos em ordem crescente de idadeInicial (o primeiro em 0).
+ * @param numSegmentos Entre 1 e FILA_ENVELHECIMENTO_MAX_SEGMENTOS.
+ * @return Ponteiro para a FilaEnvelhecimento criada, ou NULL em caso de falha
+ * ou curva inválida.
+ */
+FilaEnvelhecimento* criarFilaEnvelhecimento(const SegmentoEnvelhecimento curva[], int numSegmentos);
+
+/**
+ * @brief Prioridade efetiva de um paciente com prioridade 'base' que espera
+ * há 'idade' tiques, segundo a curva da fila.
+ */
+long long prioridadeEfetivaEnvelhecimento(const FilaEnvelhecimento *fila, int base, long long idade);
+
+/**
+ * @brief Avança o relógio global. Não percorre a fila: as migrações entre
+ * segmentos são feitas na próxima consulta, só para quem cruzou um limite.
+ * Se faltar memória para uma migração, o paciente continua no segmento
+ * anterior (com a prioridade da curva daquele segmento) até a próxima consulta.
+ * @param fila Ponteiro para a FilaEnvelhecimento.
+ * @param agora Novo valor do relógio (não pode voltar no tempo).
+ * @return HEAP_OK ou HEAP_ERRO_PARAMETRO.
+ */
+int avancarRelogioEnvelhecimento(FilaEnvelhecimento *fila, long long agora);
+
+/**
+ * @brief Insere um paciente com prioridade base p.prioridade, chegando no
+ * instante atual do relógio. O(log n).
+ * @param fila Ponteiro para a FilaEnvelhecimento.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacienteEnvelhecimento(FilaEnvelhecimento *fila, Paciente p);
+
+/**
+ * @brief Retorna, sem remover, o paciente de maior prioridade efetiva.
+ * @param fila Ponteiro para a FilaEnvelhecimento.
+ * @param prioridadeEfetiva Se não for NULL, recebe a prioridade efetiva atual.
+ * @return O Paciente (com a prioridade base). Se a fila estiver vazia,
+ * retorna um Paciente com id e prioridade -1.
+ */
+Paciente espiarMaxPacienteEnvelhecimento(FilaEnvelhecimento *fila, long long *prioridadeEfetiva);
+
+/**
+ * @brief Remove e retorna o paciente de maior prioridade efetiva no instante
+ * atual do relógio. O(k log n) para k segmentos, mais O(log n) por migração
+ * (no máximo uma por limite cruzado para cada paciente).
+ * @param fila Ponteiro para a FilaEnvelhecimento.
+ * @param prioridadeEfetiva Se não for NULL, recebe a prioridade efetiva.
+ * @return O Paciente extraído (com a prioridade base). Se a fila estiver
+ * vazia, retorna um Paciente com id e prioridade -1.
+ */
+Paciente extrairMaxPacienteEnvelhecimento(FilaEnvelhecimento *fila, long long *prioridadeEfetiva);
+
+/**
+ * @brief Verifica se a fila está vazia.
+ * @param fila Ponteiro para a FilaEnvelhecimento.
+ * @return 1 se a fila estiver vazia, 0 caso contrário.
+ */
+int filaEnvelhecimentoVazia(const FilaEnvelhecimento *fila);
+
+/**
+ * @brief Libera a memória alocada para a fila.
+ * @param fila Ponteiro para a FilaEnvelhecimento a ser liberada.
+ */
+void liberarFilaEnvelhecimento(FilaEnvelhecimento *fila);
+
+#endif // FILA_ENVELHECIMENTO_H
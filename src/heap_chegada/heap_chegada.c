@@ -0,0 +1,47 @@
+#include "heap_chegada.h"
+
+// Maior prioridade primeiro; empate resolvido pelo menor id (chegada mais antiga)
+#define PACIENTE_MAIOR_CHEGADA(a, b) \
+    ((a).prioridade > (b).prioridade || ((a).prioridade == (b).prioridade && (a).id < (b).id))
+
+HEAP_GERAR(maxHeapChegada, MaxHeapChegada, Paciente, PACIENTE_MAIOR_CHEGADA)
+
+MaxHeapChegada* criarMaxHeapChegada(int capacidadeInicial) {
+    MaxHeapChegada *heap = (MaxHeapChegada*) malloc(sizeof(MaxHeapChegada));
+    if (heap == NULL) {
+        perror("Falha ao alocar memória para heap (MaxHeapChegada)");
+        return NULL;
+    }
+    if (maxHeapChegadaInicializar(heap, capacidadeInicial, 1) != HEAP_OK) {
+        perror("Falha ao alocar memória para o array da heap (MaxHeapChegada)");
+        free(heap);
+        return NULL;
+    }
+    return heap;
+}
+
+int inserirPacienteMaxChegada(MaxHeapChegada *heap, Paciente p) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    return maxHeapChegadaInserir(heap, p);
+}
+
+Paciente extrairMaxPacienteChegada(MaxHeapChegada *heap) {
+    Paciente pVazio = {-1, -1};
+    Paciente raiz;
+    if (heap == NULL || !maxHeapChegadaExtrair(heap, &raiz)) {
+        return pVazio;
+    }
+    return raiz;
+}
+
+int maxHeapChegadaVazia(MaxHeapChegada *heap) {
+    if (heap == NULL) return 1;
+    return heap->tamanho == 0;
+}
+
+void liberarMaxHeapChegada(MaxHeapChegada *heap) {
+    if (heap != NULL) {
+        free(heap->array);
+        free(heap);
+    }
+}
@@ -0,0 +1,51 @@
+#ifndef HEAP_CHEGADA_H
+#define HEAP_CHEGADA_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "heap_generico/heap_generico.h" // HEAP_DEFINIR_TIPO
+
+// Max-Heap que desempata prioridades iguais pela ordem de chegada, assumindo
+// que os ids são atribuídos em ordem crescente na chegada (menor id sai antes).
+// Instanciada a partir do motor genérico com uma ordem de dois campos.
+HEAP_DEFINIR_TIPO(MaxHeapChegada, Paciente)
+
+/**
+ * @brief Cria uma nova Max-Heap com desempate por chegada (expansível).
+ * @param capacidadeInicial Capacidade inicial do array (pode ser 0).
+ * @return Ponteiro para a MaxHeapChegada criada, ou NULL em caso de falha.
+ */
+MaxHeapChegada* criarMaxHeapChegada(int capacidadeInicial);
+
+/**
+ * @brief Insere um paciente na Max-Heap com desempate por chegada.
+ * @param heap Ponteiro para a MaxHeapChegada.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacienteMaxChegada(MaxHeapChegada *heap, Paciente p);
+
+/**
+ * @brief Extrai o paciente de maior prioridade; entre prioridades iguais,
+ * o de menor id (o que chegou primeiro).
+ * @param heap Ponteiro para a MaxHeapChegada.
+ * @return O Paciente extraído. Se a heap estiver vazia, retorna um Paciente
+ * com id e prioridade -1.
+ */
+Paciente extrairMaxPacienteChegada(MaxHeapChegada *heap);
+
+/**
+ * @brief Verifica se a Max-Heap com desempate por chegada está vazia.
+ * @param heap Ponteiro para a MaxHeapChegada.
+ * @return 1 se a heap estiver vazia, 0 caso contrário.
+ */
+int maxHeapChegadaVazia(MaxHeapChegada *heap);
+
+/**
+ * @brief Libera a memória alocada para a Max-Heap com desempate por chegada.
+ * @param heap Ponteiro para a MaxHeapChegada a ser liberada.
+ */
+void liberarMaxHeapChegada(MaxHeapChegada *heap);
+
+#endif // HEAP_CHEGADA_H
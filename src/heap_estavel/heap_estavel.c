@@ -0,0 +1,128 @@
+#include "heap_estavel.h"
+#include "heap_generico/heap_generico.h"
+
+// A ordem depende só da chave empacotada: uma comparação de inteiros por nível
+#define ENTRADA_MAIOR(a, b) ((a).chave > (b).chave)
+#define ENTRADA_MENOR(a, b) ((a).chave < (b).chave)
+
+HEAP_GERAR(maxHeapEstavel, MaxHeapEstavel, EntradaEstavel, ENTRADA_MAIOR)
+HEAP_GERAR(minHeapEstavel, MinHeapEstavel, EntradaEstavel, ENTRADA_MENOR)
+
+static MaxHeapEstavel* criarHeapEstavel(int capacidadeInicial) {
+    MaxHeapEstavel *heap = (MaxHeapEstavel*) malloc(sizeof(MaxHeapEstavel));
+    if (heap == NULL) {
+        perror("Falha ao alocar memória para heap (HeapEstavel)");
+        return NULL;
+    }
+    if (maxHeapEstavelInicializar(heap, capacidadeInicial, 1) != HEAP_OK) {
+        perror("Falha ao alocar memória para o array da heap (HeapEstavel)");
+        free(heap);
+        return NULL;
+    }
+    heap->sequencia = 0;
+    return heap;
+}
+
+static void liberarHeapEstavel(MaxHeapEstavel *heap) {
+    if (heap != NULL) {
+        free(heap->array);
+        free(heap);
+    }
+}
+
+/**
+ * @brief Renumera as sequências 0..n-1 quando o contador de 32 bits se esgota,
+ * preservando a ordem relativa entre pacientes de mesma prioridade. Depois da
+ * ordenação (crescente na Max-Heap, decrescente na Min-Heap), a posição i
+ * recebe a sequência n-1-i nos dois casos.
+ */
+static void renumerarHeapEstavel(MaxHeapEstavel *heap, int decrescente) {
+    int n = heap->tamanho;
+    if (decrescente) {
+        maxHeapEstavelOrdenar(heap->array, n);
+    } else {
+        minHeapEstavelOrdenar(heap->array, n);
+    }
+    for (int i = 0; i < n; i++) {
+        int prioridade = heap->array[i].paciente.prioridade;
+        uint32_t sequencia = (uint32_t) (n - 1 - i);
+        heap->array[i].chave = decrescente ? chaveEstavelDecrescente(prioridade, sequencia)
+                                           : chaveEstavelCrescente(prioridade, sequencia);
+    }
+    if (decrescente) {
+        maxHeapEstavelConstruir(heap->array, n);
+    } else {
+        minHeapEstavelConstruir(heap->array, n);
+    }
+    heap->sequencia = (uint32_t) n;
+}
+
+MaxHeapEstavel* criarMaxHeapEstavel(int capacidadeInicial) {
+    return criarHeapEstavel(capacidadeInicial);
+}
+
+int inserirPacienteMaxEstavel(MaxHeapEstavel *heap, Paciente p) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    if (heap->sequencia == UINT32_MAX) {
+        renumerarHeapEstavel(heap, 1);
+    }
+    EntradaEstavel entrada = {chaveEstavelDecrescente(p.prioridade, heap->sequencia), p};
+    int status = maxHeapEstavelInserir(heap, entrada);
+    if (status == HEAP_OK) {
+        heap->sequencia++;
+    }
+    return status;
+}
+
+Paciente extrairMaxPacienteEstavel(MaxHeapEstavel *heap) {
+    Paciente pVazio = {-1, -1};
+    EntradaEstavel raiz;
+    if (heap == NULL || !maxHeapEstavelExtrair(heap, &raiz)) {
+        return pVazio;
+    }
+    return raiz.paciente;
+}
+
+int maxHeapEstavelVazia(MaxHeapEstavel *heap) {
+    if (heap == NULL) return 1;
+    return heap->tamanho == 0;
+}
+
+void liberarMaxHeapEstavel(MaxHeapEstavel *heap) {
+    liberarHeapEstavel(heap);
+}
+
+MinHeapEstavel* criarMinHeapEstavel(int capacidadeInicial) {
+    return criarHeapEstavel(capacidadeInicial);
+}
+
+int inserirPacienteMinEstavel(MinHeapEstavel *heap, Paciente p) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    if (heap->sequencia == UINT32_MAX) {
+        renumerarHeapEstavel(heap, 0);
+    }
+    EntradaEstavel entrada = {chaveEstavelCrescente(p.prioridade, heap->sequencia), p};
+    int status = minHeapEstavelInserir(heap, entrada);
+    if (status == HEAP_OK) {
+        heap->sequencia++;
+    }
+    return status;
+}
+
+Paciente extrairMinPacienteEstavel(MinHeapEstavel *heap) {
+    Paciente pVazio = {-1, -1};
+    EntradaEstavel raiz;
+    if (heap == NULL || !minHeapEstavelExtrair(heap, &raiz)) {
+        return pVazio;
+    }
+    return raiz.paciente;
+}
+
+int minHeapEstavelVazia(MinHeapEstavel *heap) {
+    if (heap == NULL) return 1;
+    return heap->tamanho == 0;
+}
+
+void liberarMinHeapEstavel(MinHeapEstavel *heap) {
+    liberarHeapEstavel(heap);
+}
@@ -0,0 +1,131 @@
+#ifndef HEAP_ESTAVEL_H
+#define HEAP_ESTAVEL_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include <stdint.h> // uint32_t, uint64_t
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Heaps estáveis: pacientes de mesma prioridade saem na ordem de inserção
+// (FIFO). Cada inserção recebe um número de sequência crescente e a ordem da
+// heap usa uma única chave de 64 bits com a prioridade nos 32 bits altos e a
+// sequência (invertida na Max-Heap) nos 32 bits baixos, de modo que cada
+// comparação do heapify é uma única comparação de inteiros.
+
+/**
+ * @brief Converte a prioridade em 32 bits sem sinal preservando a ordem.
+ */
+static inline uint64_t chavePrioridade(int prioridade) {
+    return (uint64_t) ((uint32_t) prioridade ^ 0x80000000u) << 32;
+}
+
+/**
+ * @brief Chave para ordem crescente: prioridade menor primeiro e, no empate,
+ * sequência menor primeiro.
+ */
+static inline uint64_t chaveEstavelCrescente(int prioridade, uint32_t sequencia) {
+    return chavePrioridade(prioridade) | sequencia;
+}
+
+/**
+ * @brief Chave para ordem decrescente: prioridade maior primeiro e, no empate,
+ * sequência menor primeiro (sequência invertida nos bits baixos).
+ */
+static inline uint64_t chaveEstavelDecrescente(int prioridade, uint32_t sequencia) {
+    return chavePrioridade(prioridade) | (UINT32_MAX - sequencia);
+}
+
+// Elemento das heaps estáveis: chave empacotada e o paciente original
+typedef struct {
+    uint64_t chave;
+    Paciente paciente;
+} EntradaEstavel;
+
+// Estrutura das heaps estáveis (mesmos campos das heaps do motor genérico
+// mais o contador de sequência)
+typedef struct {
+    EntradaEstavel *array; // Ponteiro para o array de entradas
+    int tamanho;           // Número atual de pacientes na heap
+    int capacidade;        // Capacidade atual do array
+    int expansivel;        // Sempre 1: o array cresce automaticamente
+    uint32_t sequencia;    // Próximo número de sequência
+} MaxHeapEstavel, MinHeapEstavel;
+
+/**
+ * @brief Cria uma nova Max-Heap estável (expansível).
+ * @param capacidadeInicial Capacidade inicial do array (pode ser 0).
+ * @return Ponteiro para a MaxHeapEstavel criada, ou NULL em caso de falha.
+ */
+MaxHeapEstavel* criarMaxHeapEstavel(int capacidadeInicial);
+
+/**
+ * @brief Insere um paciente na Max-Heap estável, carimbando-o com o próximo
+ * número de sequência. Se a sequência de 32 bits se esgotar, as entradas
+ * atuais são renumeradas (O(n log n), uma vez a cada 2^32 inserções).
+ * @param heap Ponteiro para a MaxHeapEstavel.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacienteMaxEstavel(MaxHeapEstavel *heap, Paciente p);
+
+/**
+ * @brief Extrai o paciente de maior prioridade; entre prioridades iguais,
+ * o que foi inserido primeiro.
+ * @param heap Ponteiro para a MaxHeapEstavel.
+ * @return O Paciente extraído. Se a heap estiver vazia, retorna um Paciente
+ * com id e prioridade -1.
+ */
+Paciente extrairMaxPacienteEstavel(MaxHeapEstavel *heap);
+
+/**
+ * @brief Verifica se a Max-Heap estável está vazia.
+ * @param heap Ponteiro para a MaxHeapEstavel.
+ * @return 1 se a heap estiver vazia, 0 caso contrário.
+ */
+int maxHeapEstavelVazia(MaxHeapEstavel *heap);
+
+/**
+ * @brief Libera a memória alocada para a Max-Heap estável.
+ * @param heap Ponteiro para a MaxHeapEstavel a ser liberada.
+ */
+void liberarMaxHeapEstavel(MaxHeapEstavel *heap);
+
+/**
+ * @brief Cria uma nova Min-Heap estável (expansível).
+ * @param capacidadeInicial Capacidade inicial do array (pode ser 0).
+ * @return Ponteiro para a MinHeapEstavel criada, ou NULL em caso de falha.
+ */
+MinHeapEstavel* criarMinHeapEstavel(int capacidadeInicial);
+
+/**
+ * @brief Insere um paciente na Min-Heap estável (ver inserirPacienteMaxEstavel).
+ * @param heap Ponteiro para a MinHeapEstavel.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacienteMinEstavel(MinHeapEstavel *heap, Paciente p);
+
+/**
+ * @brief Extrai o paciente de menor prioridade; entre prioridades iguais,
+ * o que foi inserido primeiro.
+ * @param heap Ponteiro para a MinHeapEstavel.
+ * @return O Paciente extraído. Se a heap estiver vazia, retorna um Paciente
+ * com id e prioridade -1.
+ */
+Paciente extrairMinPacienteEstavel(MinHeapEstavel *heap);
+
+/**
+ * @brief Verifica se a Min-Heap estável está vazia.
+ * @param heap Ponteiro para a MinHeapEstavel.
+ * @return 1 se a heap estiver vazia, 0 caso contrário.
+ */
+int minHeapEstavelVazia(MinHeapEstavel *heap);
+
+/**
+ * @brief Libera a memória alocada para a Min-Heap estável.
+ * @param heap Ponteiro para a MinHeapEstavel a ser liberada.
+ */
+void liberarMinHeapEstavel(MinHeapEstavel *heap);
+
+#endif // HEAP_ESTAVEL_H
@@ -0,0 +1,533 @@
+#ifndef HEAP_GENERICO_H
+#define HEAP_GENERICO_H
+
+#include <limits.h> // INT_MAX
+#include <stdint.h> // SIZE_MAX
+#include <stdlib.h> // Para malloc, realloc, free
+#include <string.h> // memcpy
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+#include "includes/heap_indice.h" // HeapIndice (int ou 64 bits com HEAP_LARGA_ESCALA)
+
+/*
+ * Motor genérico de heap binária, especializado em tempo de compilação.
+ *
+ * HEAP_GERAR(prefixo, TipoHeap, TipoElem, ANTES) gera funções static inline
+ * (prefixoInserir, prefixoExtrair, prefixoDescer, ...) para um TipoHeap que
+ * tenha os campos 'array', 'tamanho', 'capacidade' e 'expansivel'. Tamanhos e
+ * índices são HeapIndice; os campos da struct podem ser HeapIndice ou int.
+ * ANTES(a, b) é uma macro que recebe dois elementos e é verdadeira quando 'a'
+ * deve ficar mais perto da raiz que 'b'. Como a ordem e o tipo do elemento são
+ * expandidos no código gerado, não há chamada por ponteiro de função.
+ */
+
+// Um lote com ao menos tamanho/HEAP_LIMIAR_RECONSTRUCAO_LOTE elementos é inserido
+// com reconstrução de Floyd (O(n + k)) em vez de k heapify-ups (O(k log n)).
+// Medido no bench_heap: com prioridades aleatórias o ponto de equilíbrio fica
+// perto de k = n/2; com prioridades crescentes (pior caso do heapify-up), perto
+// de k = n/16. O divisor 4 mantém a perda pequena nos dois cenários.
+#define HEAP_LIMIAR_RECONSTRUCAO_LOTE 4
+
+// Lotes de extração de até HEAP_LOTE_PILHA elementos usam memória auxiliar na
+// pilha; maiores alocam um bloco temporário.
+#define HEAP_LOTE_PILHA 64
+
+// A extração em lote pela fronteira (prefixo##ExtrairLote) faz cerca de 45% menos
+// comparações que k extrações individuais, mas move o mesmo número de elementos
+// e paga a fronteira: com chaves baratas (um int) perde de 5% a 45% no
+// bench_heap --secao extrairlote, e mesmo com desempate por strcmp só empata.
+// Por isso ExtrairLote faz k extrações individuais, a não ser que quem inclui
+// o motor defina HEAP_COMPARACAO_CARA como 1 antes do #include (ordens cuja
+// comparação custa bem mais que mover o elemento, ou que contam comparações).
+#ifndef HEAP_COMPARACAO_CARA
+#define HEAP_COMPARACAO_CARA 0
+#endif
+
+// Ordens pré-definidas para Paciente
+#define PACIENTE_MAIOR(a, b) ((a).prioridade > (b).prioridade)
+#define PACIENTE_MENOR(a, b) ((a).prioridade < (b).prioridade)
+
+/**
+ * @brief Retorna o índice do pai do nó i.
+ */
+static inline HeapIndice heapPai(HeapIndice i) {
+    return (i - 1) / 2;
+}
+
+/**
+ * @brief Retorna o índice do filho esquerdo do nó i.
+ */
+static inline HeapIndice heapFilhoEsquerda(HeapIndice i) {
+    return (2 * i) + 1;
+}
+
+/**
+ * @brief Retorna o índice do filho direito do nó i.
+ */
+static inline HeapIndice heapFilhoDireita(HeapIndice i) {
+    return (2 * i) + 2;
+}
+
+/**
+ * @brief Declara um tipo de heap com os campos esperados por HEAP_GERAR.
+ */
+#define HEAP_DEFINIR_TIPO(TipoHeap, TipoElem)                                          \
+typedef struct {                                                                       \
+    TipoElem *array; /* Ponteiro para o array de elementos */                          \
+    HeapIndice tamanho;    /* Número atual de elementos na heap */                     \
+    HeapIndice capacidade; /* Capacidade atual do array */                             \
+    int expansivel;  /* 1 se o array cresce automaticamente quando cheio */            \
+} TipoHeap;
+
+// Movimento de um elemento do array. Todas as operações do motor movem
+// elementos por aqui, o que permite a quem inclui o motor contar movimentos
+// (ex.: bench_heap) definindo HEAP_MOVER antes do #include.
+#ifndef HEAP_MOVER
+#define HEAP_MOVER(destino, origem) ((destino) = (origem))
+#endif
+
+// Heaps cujo array pode não ter vindo de malloc (bloco único com a struct,
+// memória do chamador ou arena) definem HEAP_ARRAY_EMPRESTADO(heap) e
+// HEAP_ASSUMIR_ARRAY(heap) antes do #include. Um array emprestado nunca é
+// passado a realloc: ao crescer, os elementos são copiados para um array
+// próprio e HEAP_ASSUMIR_ARRAY registra a troca; encolher não faz nada.
+#ifndef HEAP_ARRAY_EMPRESTADO
+#define HEAP_ARRAY_EMPRESTADO(heap) 0
+#define HEAP_ASSUMIR_ARRAY(heap) ((void) 0)
+#endif
+
+// Alocação do array próprio, com a semântica de realloc (array NULL aloca um
+// novo). Heaps que alocam o array de outra forma (ex.: páginas grandes)
+// definem HEAP_REALOCAR antes do #include; liberar o array fica com elas.
+#ifndef HEAP_REALOCAR
+#define HEAP_REALOCAR(heap, array, bytes) realloc((array), (bytes))
+#endif
+
+// Maior tamanho aceito por uma heap: HEAP_TAMANHO_MAX, ou INT_MAX / 2 se os
+// campos da struct forem int em vez de HeapIndice.
+#define HEAP_LIMITE(heap) (sizeof((heap)->capacidade) < sizeof(HeapIndice) \
+                           ? (HeapIndice) (INT_MAX / 2) : (HeapIndice) HEAP_TAMANHO_MAX)
+
+/**
+ * @brief Gera as operações sobre arrays (heapify e heapsort) para TipoElem com
+ * a ordem ANTES. Os heapify usam "buraco": o elemento em movimento fica em uma
+ * variável local e cada nível custa um único movimento, em vez de uma troca.
+ */
+#define HEAP_GERAR_ARRAY(prefixo, TipoElem, ANTES)                                     \
+                                                                                       \
+static inline void prefixo##Trocar(TipoElem *a, TipoElem *b) {                         \
+    TipoElem temp = *a;                                                                \
+    *a = *b;                                                                           \
+    *b = temp;                                                                         \
+}                                                                                      \
+                                                                                       \
+/* Sobe 'x' a partir do buraco em 'index' e o grava na posição final */                \
+static inline void prefixo##SubirValor(TipoElem array[], HeapIndice index, TipoElem x) { \
+    while (index > 0 && ANTES(x, array[heapPai(index)])) {                             \
+        HEAP_MOVER(array[index], array[heapPai(index)]);                               \
+        index = heapPai(index);                                                        \
+    }                                                                                  \
+    HEAP_MOVER(array[index], x);                                                       \
+}                                                                                      \
+                                                                                       \
+static inline void prefixo##Subir(TipoElem array[], HeapIndice index) {                \
+    TipoElem x = array[index];                                                         \
+    prefixo##SubirValor(array, index, x);                                              \
+}                                                                                      \
+                                                                                       \
+/* Desce 'x' a partir do buraco em 'index' (heap de n elementos) */                    \
+static inline void prefixo##DescerValor(TipoElem array[], HeapIndice n, HeapIndice index, \
+                                         TipoElem x) {                                 \
+    HeapIndice filho;                                                                  \
+    while ((filho = heapFilhoEsquerda(index)) < n) {                                   \
+        if (filho + 1 < n && ANTES(array[filho + 1], array[filho])) {                  \
+            filho++;                                                                   \
+        }                                                                              \
+        if (!ANTES(array[filho], x)) {                                                 \
+            break;                                                                     \
+        }                                                                              \
+        HEAP_MOVER(array[index], array[filho]);                                        \
+        index = filho;                                                                 \
+    }                                                                                  \
+    HEAP_MOVER(array[index], x);                                                       \
+}                                                                                      \
+                                                                                       \
+/* Desce o buraco em 'index' até uma folha pelo melhor filho (uma comparação por */  \
+/* nível) e sobe 'x' de lá sem passar de 'index'. Vale a pena quando 'x' tende a */    \
+/* voltar perto das folhas (ex.: um elemento vindo do fim do array). */                \
+static inline void prefixo##DescerValorBottomUp(TipoElem array[], HeapIndice n,       \
+                                                 HeapIndice index, TipoElem x) {       \
+    HeapIndice topo = index;                                                           \
+    HeapIndice filho;                                                                  \
+    while ((filho = heapFilhoEsquerda(index)) < n) {                                   \
+        if (filho + 1 < n && ANTES(array[filho + 1], array[filho])) {                  \
+            filho++;                                                                   \
+        }                                                                              \
+        HEAP_MOVER(array[index], array[filho]);                                        \
+        index = filho;                                                                 \
+    }                                                                                  \
+    while (index > topo && ANTES(x, array[heapPai(index)])) {                          \
+        HEAP_MOVER(array[index], array[heapPai(index)]);                               \
+        index = heapPai(index);                                                        \
+    }                                                                                  \
+    HEAP_MOVER(array[index], x);                                                       \
+}                                                                                      \
+                                                                                       \
+static inline void prefixo##Descer(TipoElem array[], HeapIndice n, HeapIndice index) { \
+    TipoElem x = array[index];                                                         \
+    prefixo##DescerValor(array, n, index, x);                                          \
+}                                                                                      \
+                                                                                       \
+static inline void prefixo##Construir(TipoElem array[], HeapIndice n) {                \
+    for (HeapIndice i = n / 2 - 1; i >= 0; i--) {                                      \
+        prefixo##Descer(array, n, i);                                                  \
+    }                                                                                  \
+}                                                                                      \
+                                                                                       \
+/* Incorpora array[anterior..n) à heap array[0..anterior): reconstrução de Floyd */   \
+/* se forem muitos (ver HEAP_LIMIAR_RECONSTRUCAO_LOTE), senão heapify-up um a um */    \
+static inline void prefixo##Incorporar(TipoElem array[], HeapIndice anterior, HeapIndice n) { \
+    if (n - anterior >= anterior / HEAP_LIMIAR_RECONSTRUCAO_LOTE) {                    \
+        prefixo##Construir(array, n);                                                  \
+    } else {                                                                           \
+        for (HeapIndice i = anterior; i < n; i++) {                                    \
+            prefixo##Subir(array, i);                                                  \
+        }                                                                              \
+    }                                                                                  \
+}                                                                                      \
+                                                                                       \
+/* Heapsort clássico: a raiz vai para o fim e o último elemento desce da raiz. */      \
+/* Com ANTES = "maior", o resultado fica em ordem crescente. */                        \
+static inline void prefixo##Ordenar(TipoElem array[], HeapIndice n) {                  \
+    prefixo##Construir(array, n);                                                      \
+    for (HeapIndice m = n - 1; m > 0; m--) {                                           \
+        TipoElem x = array[m];                                                         \
+        HEAP_MOVER(array[m], array[0]);                                                \
+        prefixo##DescerValor(array, m, 0, x);                                          \
+    }                                                                                  \
+}                                                                                      \
+                                                                                       \
+/* Heapsort bottom-up (Wegener): o buraco da raiz desce até uma folha seguindo */      \
+/* o melhor filho (uma comparação por nível) e o último elemento sobe de lá. */        \
+/* Como o elemento reinserido costuma voltar a uma folha, isso quase reduz à */        \
+/* metade as comparações do heapsort clássico (duas por nível). */                     \
+static inline void prefixo##OrdenarBottomUp(TipoElem array[], HeapIndice n) {          \
+    prefixo##Construir(array, n);                                                      \
+    for (HeapIndice m = n - 1; m > 0; m--) {                                           \
+        TipoElem x = array[m];                                                         \
+        HEAP_MOVER(array[m], array[0]);                                                \
+        HeapIndice index = 0;                                                          \
+        HeapIndice filho;                                                              \
+        while ((filho = heapFilhoEsquerda(index)) < m) {                               \
+            if (filho + 1 < m && ANTES(array[filho + 1], array[filho])) {              \
+                filho++;                                                               \
+            }                                                                          \
+            HEAP_MOVER(array[index], array[filho]);                                    \
+            index = filho;                                                             \
+        }                                                                              \
+        prefixo##SubirValor(array, index, x);                                          \
+    }                                                                                  \
+}
+
+/**
+ * @brief Gera as operações da heap para o TipoHeap/TipoElem com a ordem ANTES
+ * (inclui as operações de HEAP_GERAR_ARRAY).
+ */
+#define HEAP_GERAR(prefixo, TipoHeap, TipoElem, ANTES)                                 \
+                                                                                       \
+HEAP_GERAR_ARRAY(prefixo, TipoElem, ANTES)                                             \
+                                                                                       \
+static inline int prefixo##Redimensionar(TipoHeap *heap, HeapIndice novaCapacidade) {  \
+    /* Os bytes são calculados em size_t; uma capacidade que não cabe é falta de memória */ \
+    if ((size_t) novaCapacidade > SIZE_MAX / sizeof(TipoElem)) {                       \
+        return HEAP_ERRO_MEMORIA;                                                      \
+    }                                                                                  \
+    if (HEAP_ARRAY_EMPRESTADO(heap)) {                                                 \
+        if (novaCapacidade <= heap->capacidade) {                                      \
+            return HEAP_OK;                                                            \
+        }                                                                              \
+        TipoElem *proprio = (TipoElem*) HEAP_REALOCAR(heap, NULL,                      \
+                                                      (size_t) novaCapacidade * sizeof(TipoElem)); \
+        if (proprio == NULL) {                                                         \
+            return HEAP_ERRO_MEMORIA;                                                  \
+        }                                                                              \
+        if (heap->tamanho > 0) {                                                       \
+            memcpy(proprio, heap->array, (size_t) heap->tamanho * sizeof(TipoElem));   \
+        }                                                                              \
+        heap->array = proprio;                                                         \
+        heap->capacidade = novaCapacidade;                                             \
+        HEAP_ASSUMIR_ARRAY(heap);                                                      \
+        return HEAP_OK;                                                                \
+    }                                                                                  \
+    /* realloc(ptr, 0) é dependente de implementação; mantém ao menos 1 posição */     \
+    size_t bytes = (size_t) (novaCapacidade > 0 ? novaCapacidade : 1) * sizeof(TipoElem); \
+    TipoElem *novo = (TipoElem*) HEAP_REALOCAR(heap, heap->array, bytes);              \
+    if (novo == NULL) {                                                                \
+        return HEAP_ERRO_MEMORIA;                                                      \
+    }                                                                                  \
+    heap->array = novo;                                                                \
+    heap->capacidade = novaCapacidade;                                                 \
+    return HEAP_OK;                                                                    \
+}                                                                                      \
+                                                                                       \
+/* Garante espaço para 'necessario' elementos, com crescimento geométrico */           \
+static inline int prefixo##Garantir(TipoHeap *heap, HeapIndice necessario) {           \
+    if (necessario <= heap->capacidade) {                                              \
+        return HEAP_OK;                                                                \
+    }                                                                                  \
+    HeapIndice limite = HEAP_LIMITE(heap);                                             \
+    if (!heap->expansivel || necessario > limite) {                                    \
+        return HEAP_ERRO_CHEIA;                                                        \
+    }                                                                                  \
+    HeapIndice nova = heap->capacidade < 8 ? 8                                         \
+                    : (heap->capacidade > limite / 2 ? limite : heap->capacidade * 2); \
+    return prefixo##Redimensionar(heap, nova > necessario ? nova : necessario);        \
+}                                                                                      \
+                                                                                       \
+static inline int prefixo##Inicializar(TipoHeap *heap, HeapIndice capacidade, int expansivel) { \
+    heap->array = NULL;                                                                \
+    heap->tamanho = 0;                                                                 \
+    heap->expansivel = expansivel;                                                     \
+    return prefixo##Redimensionar(heap, capacidade > 0 ? capacidade : 0);              \
+}                                                                                      \
+                                                                                       \
+static inline int prefixo##Inserir(TipoHeap *heap, TipoElem x) {                       \
+    if (heap->tamanho >= HEAP_LIMITE(heap)) {                                          \
+        return HEAP_ERRO_CHEIA;                                                        \
+    }                                                                                  \
+    int status = prefixo##Garantir(heap, heap->tamanho + 1);                           \
+    if (status != HEAP_OK) {                                                           \
+        return status;                                                                 \
+    }                                                                                  \
+    heap->tamanho++;                                                                   \
+    prefixo##SubirValor(heap->array, heap->tamanho - 1, x);                            \
+    return HEAP_OK;                                                                    \
+}                                                                                      \
+                                                                                       \
+/* Retorna 1 e escreve a raiz em *saida, ou 0 se a heap estiver vazia */               \
+static inline int prefixo##Extrair(TipoHeap *heap, TipoElem *saida) {                  \
+    if (heap->tamanho <= 0) {                                                          \
+        return 0;                                                                      \
+    }                                                                                  \
+    *saida = heap->array[0];                                                           \
+    heap->tamanho--;                                                                   \
+    if (heap->tamanho > 0) {                                                           \
+        prefixo##DescerValor(heap->array, heap->tamanho, 0, heap->array[heap->tamanho]); \
+    }                                                                                  \
+    return 1;                                                                          \
+}                                                                                      \
+                                                                                       \
+/* Entrada da fronteira de prefixo##ExtrairLote: um elemento e sua posição */      \
+typedef struct {                                                                       \
+    TipoElem valor;                                                                    \
+    HeapIndice indice;                                                                 \
+} prefixo##EntradaFronteira;                                                           \
+                                                                                       \
+static inline void prefixo##FronteiraSubir(prefixo##EntradaFronteira f[], HeapIndice index, \
+                                           prefixo##EntradaFronteira x) {              \
+    while (index > 0 && ANTES(x.valor, f[heapPai(index)].valor)) {                     \
+        f[index] = f[heapPai(index)];                                                  \
+        index = heapPai(index);                                                        \
+    }                                                                                  \
+    f[index] = x;                                                                      \
+}                                                                                      \
+                                                                                       \
+static inline void prefixo##FronteiraDescer(prefixo##EntradaFronteira f[], HeapIndice n, \
+                                            prefixo##EntradaFronteira x) {             \
+    HeapIndice index = 0;                                                              \
+    HeapIndice filho;                                                                  \
+    while ((filho = heapFilhoEsquerda(index)) < n) {                                   \
+        if (filho + 1 < n && ANTES(f[filho + 1].valor, f[filho].valor)) {              \
+            filho++;                                                                   \
+        }                                                                              \
+        if (!ANTES(f[filho].valor, x.valor)) {                                         \
+            break;                                                                     \
+        }                                                                              \
+        f[index] = f[filho];                                                           \
+        index = filho;                                                                 \
+    }                                                                                  \
+    f[index] = x;                                                                      \
+}                                                                                      \
+                                                                                       \
+/* Extrai até k elementos em ordem de ANTES (o primeiro é a raiz). Sem */              \
+/* HEAP_COMPARACAO_CARA, são k extrações individuais. Com ela, os */                   \
+/* extraídos formam uma subárvore que contém a raiz; uma heap auxiliar (fronteira) */  \
+/* com os filhos ainda não extraídos os coleta em O(k log k). Os buracos abaixo do */  \
+/* novo tamanho recebem os elementos da cauda que ficaram e descem (bottom-up, uma */ \
+/* comparação por nível) em ordem inversa à de extração, isto é, filhos antes dos */   \
+/* pais: um Floyd só sobre os buracos, O(k log n). */                                  \
+/* Quando k log n passa de n, a heap inteira é reconstruída com Floyd. */              \
+static inline HeapIndice prefixo##ExtrairLote(TipoHeap *heap, HeapIndice k, TipoElem saida[]) { \
+    HeapIndice n = heap->tamanho;                                                      \
+    if (k > n) k = n;                                                                  \
+    if (k <= 0) return 0;                                                              \
+    if (!HEAP_COMPARACAO_CARA) {                                                       \
+        for (HeapIndice j = 0; j < k; j++) {                                           \
+            prefixo##Extrair(heap, &saida[j]);                                         \
+        }                                                                              \
+        return k;                                                                      \
+    }                                                                                  \
+    prefixo##EntradaFronteira fronteiraPilha[HEAP_LOTE_PILHA];                         \
+    HeapIndice posicoesPilha[HEAP_LOTE_PILHA];                                         \
+    unsigned char removidosPilha[HEAP_LOTE_PILHA];                                     \
+    prefixo##EntradaFronteira *fronteira = fronteiraPilha;                             \
+    HeapIndice *posicoes = posicoesPilha;                                              \
+    unsigned char *removidos = removidosPilha;                                         \
+    void *bloco = NULL;                                                                \
+    if (k > HEAP_LOTE_PILHA) {                                                         \
+        size_t porEntrada = sizeof(*fronteira) + sizeof(*posicoes) + 1;                \
+        if ((size_t) k <= SIZE_MAX / porEntrada) {                                     \
+            bloco = malloc((size_t) k * porEntrada);                                   \
+        }                                                                              \
+        if (bloco == NULL) {                                                           \
+            /* Sem memória auxiliar: extrações individuais */                          \
+            for (HeapIndice j = 0; j < k; j++) {                                       \
+                prefixo##Extrair(heap, &saida[j]);                                     \
+            }                                                                          \
+            return k;                                                                  \
+        }                                                                              \
+        fronteira = (prefixo##EntradaFronteira*) bloco;                                \
+        posicoes = (HeapIndice*) (fronteira + k);                                      \
+        removidos = (unsigned char*) (posicoes + k);                                   \
+    }                                                                                  \
+                                                                                       \
+    TipoElem *array = heap->array;                                                     \
+    HeapIndice tamanhoFronteira = 1;                                                   \
+    fronteira[0].valor = array[0];                                                     \
+    fronteira[0].indice = 0;                                                           \
+    for (HeapIndice j = 0; j < k; j++) {                                               \
+        HeapIndice topo = fronteira[0].indice;                                         \
+        saida[j] = fronteira[0].valor;                                                 \
+        posicoes[j] = topo;                                                            \
+        if (j == k - 1) break;                                                         \
+        /* O filho esquerdo ocupa o lugar do topo e o direito entra no fim */          \
+        HeapIndice esquerdo = heapFilhoEsquerda(topo);                                 \
+        prefixo##EntradaFronteira x;                                                   \
+        if (esquerdo < n) {                                                            \
+            x.valor = array[esquerdo];                                                 \
+            x.indice = esquerdo;                                                       \
+        } else {                                                                       \
+            x = fronteira[--tamanhoFronteira];                                         \
+        }                                                                              \
+        prefixo##FronteiraDescer(fronteira, tamanhoFronteira, x);                      \
+        if (esquerdo + 1 < n) {                                                        \
+            x.valor = array[esquerdo + 1];                                             \
+            x.indice = esquerdo + 1;                                                   \
+            prefixo##FronteiraSubir(fronteira, tamanhoFronteira++, x);                 \
+        }                                                                              \
+    }                                                                                  \
+                                                                                       \
+    HeapIndice m = n - k;                                                              \
+    memset(removidos, 0, (size_t) k);                                                  \
+    for (HeapIndice j = 0; j < k; j++) {                                               \
+        if (posicoes[j] >= m) removidos[posicoes[j] - m] = 1;                          \
+    }                                                                                  \
+    int niveis = 0;                                                                    \
+    for (HeapIndice t = m; t > 1; t >>= 1) niveis++;                                   \
+    /* k * niveis >= m, sem multiplicar */                                             \
+    int reconstruir = niveis > 0 ? k >= (m + niveis - 1) / niveis : m == 0;            \
+    HeapIndice fonte = m;                                                              \
+    for (HeapIndice j = k - 1; j >= 0; j--) {                                          \
+        HeapIndice buraco = posicoes[j];                                               \
+        if (buraco >= m) continue;                                                     \
+        while (removidos[fonte - m]) fonte++;                                          \
+        TipoElem x = array[fonte++];                                                   \
+        if (reconstruir) {                                                             \
+            HEAP_MOVER(array[buraco], x);                                              \
+        } else {                                                                       \
+            prefixo##DescerValorBottomUp(array, m, buraco, x);                         \
+        }                                                                              \
+    }                                                                                  \
+    heap->tamanho = m;                                                                 \
+    if (reconstruir) {                                                                 \
+        prefixo##Construir(array, m);                                                  \
+    }                                                                                  \
+    free(bloco);                                                                       \
+    return k;                                                                          \
+}                                                                                      \
+                                                                                       \
+static inline int prefixo##InserirLote(TipoHeap *heap, const TipoElem lote[], HeapIndice k) { \
+    if (k == 0) return HEAP_OK;                                                        \
+    if (k > HEAP_LIMITE(heap) - heap->tamanho) return HEAP_ERRO_CHEIA;                 \
+    HeapIndice necessario = heap->tamanho + k;                                         \
+    int status = prefixo##Garantir(heap, necessario);                                  \
+    if (status != HEAP_OK) {                                                           \
+        return status;                                                                 \
+    }                                                                                  \
+    HeapIndice anterior = heap->tamanho;                                               \
+    memcpy(heap->array + anterior, lote, (size_t) k * sizeof(TipoElem));               \
+    heap->tamanho = necessario;                                                        \
+    prefixo##Incorporar(heap->array, anterior, necessario);                            \
+    return HEAP_OK;                                                                    \
+}                                                                                      \
+                                                                                       \
+static inline int prefixo##Reservar(TipoHeap *heap, HeapIndice capacidade) {           \
+    if (capacidade <= heap->capacidade) {                                              \
+        return HEAP_OK;                                                                \
+    }                                                                                  \
+    if (capacidade > HEAP_LIMITE(heap)) {                                              \
+        return HEAP_ERRO_PARAMETRO;                                                    \
+    }                                                                                  \
+    return prefixo##Redimensionar(heap, capacidade);                                   \
+}                                                                                      \
+                                                                                       \
+static inline int prefixo##Encolher(TipoHeap *heap) {                                  \
+    if (heap->capacidade == heap->tamanho) {                                           \
+        return HEAP_OK;                                                                \
+    }                                                                                  \
+    return prefixo##Redimensionar(heap, heap->tamanho);                                \
+}
+
+/**
+ * @brief Gera a inserção adiada (buffer de chegadas) para um TipoHeap já gerado
+ * com HEAP_GERAR e que tenha também os campos 'pendentes' e 'melhorPendente'
+ * (HeapIndice). Os pendentes são os últimos 'pendentes' elementos do array,
+ * fora de ordem: array[0..tamanho - pendentes) é a heap e 'melhorPendente' é o
+ * índice do melhor deles, o que mantém a consulta do topo em O(1). Como o
+ * buffer fica no próprio array, crescer, encolher e trocar o array funcionam
+ * sem mudança; as demais operações do motor exigem pendentes == 0, isto é,
+ * prefixo##Consolidar antes.
+ */
+#define HEAP_GERAR_ADIADO(prefixo, TipoHeap, TipoElem, ANTES)                          \
+                                                                                       \
+/* Acrescenta 'x' ao buffer sem heapify-up */                                          \
+static inline int prefixo##InserirAdiado(TipoHeap *heap, TipoElem x) {                 \
+    if (heap->tamanho >= HEAP_LIMITE(heap)) {                                          \
+        return HEAP_ERRO_CHEIA;                                                        \
+    }                                                                                  \
+    int status = prefixo##Garantir(heap, heap->tamanho + 1);                           \
+    if (status != HEAP_OK) {                                                           \
+        return status;                                                                 \
+    }                                                                                  \
+    HeapIndice index = heap->tamanho++;                                                \
+    HEAP_MOVER(heap->array[index], x);                                                 \
+    if (heap->pendentes == 0 || ANTES(x, heap->array[heap->melhorPendente])) {         \
+        heap->melhorPendente = index;                                                  \
+    }                                                                                  \
+    heap->pendentes++;                                                                 \
+    return HEAP_OK;                                                                    \
+}                                                                                      \
+                                                                                       \
+/* Leva os pendentes para a heap (Floyd ou heapify-up, como um lote) */                \
+static inline void prefixo##Consolidar(TipoHeap *heap) {                               \
+    if (heap->pendentes == 0) {                                                        \
+        return;                                                                        \
+    }                                                                                  \
+    prefixo##Incorporar(heap->array, heap->tamanho - heap->pendentes, heap->tamanho);  \
+    heap->pendentes = 0;                                                               \
+}                                                                                      \
+                                                                                       \
+/* Retorna 1 e escreve o topo em *saida sem consolidar, ou 0 se estiver vazia */       \
+static inline int prefixo##Espiar(const TipoHeap *heap, TipoElem *saida) {             \
+    if (heap->tamanho <= 0) {                                                          \
+        return 0;                                                                      \
+    }                                                                                  \
+    if (heap->pendentes > 0 && (heap->pendentes == heap->tamanho                       \
+                                || ANTES(heap->array[heap->melhorPendente], heap->array[0]))) { \
+        *saida = heap->array[heap->melhorPendente];                                    \
+    } else {                                                                           \
+        *saida = heap->array[0];                                                       \
+    }                                                                                  \
+    return 1;                                                                          \
+}
+
+#endif // HEAP_GENERICO_H
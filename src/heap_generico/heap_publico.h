@@ -0,0 +1,330 @@
+#ifndef HEAP_PUBLICO_H
+#define HEAP_PUBLICO_H
+
+/*
+ * API pública comum da MaxHeap e da MinHeap de Pacientes.
+ *
+ * max_heap.c e min_heap.c incluem este arquivo (depois do próprio cabeçalho,
+ * que declara a struct) e chamam HEAP_GERAR_PUBLICO(Sufixo, prefixo, ORDEM)
+ * uma vez, com Sufixo = Max ou Min, prefixo = max ou min e ORDEM =
+ * PACIENTE_MAIOR ou PACIENTE_MENOR. A macro instancia o motor genérico
+ * (HEAP_GERAR e HEAP_GERAR_ADIADO com o prefixo prefixo##Heap) e gera todas as
+ * funções públicas (criarMaxHeap, inserirPacienteMax, extrairMaxPacienteHeap,
+ * ...), de modo que cada wrapper existe uma única vez para as duas heaps.
+ *
+ * Como define os ganchos do motor (HEAP_MOVER, HEAP_ARRAY_EMPRESTADO,
+ * HEAP_ASSUMIR_ARRAY e HEAP_REALOCAR) e inclui heap_generico.h, deve ser
+ * incluído antes de qualquer outra inclusão do motor no mesmo arquivo.
+ */
+
+#include <stdint.h> // SIZE_MAX
+#include <string.h> // memset, memcpy
+
+#ifdef HEAP_INSTRUMENTACAO
+// Contadores do motor genérico para a instância deste arquivo (ver
+// heap_estatisticas.h); cada arquivo que inclui este tem os seus.
+static HEAP_LOCAL_THREAD ContadoresHeap contadoresPublico;
+#define HEAP_MOVER(destino, origem) (contadoresPublico.movimentos++, (destino) = (origem))
+#define PACIENTE_MAIOR_INSTRUMENTADO(a, b) (contadoresPublico.comparacoes++, PACIENTE_MAIOR(a, b))
+#define PACIENTE_MENOR_INSTRUMENTADO(a, b) (contadoresPublico.comparacoes++, PACIENTE_MENOR(a, b))
+#define HEAP_PUBLICO_CONTAR_CRESCIMENTO(heap)                                          \
+    ((heap)->capacidade > capacidadeInstrumentacao                                     \
+         ? (void) (heap)->estatisticas.crescimentos++                                  \
+         : (void) marcaInstrumentacao)
+#define HEAP_PUBLICO_COPIAR_ESTATISTICAS(heap, saida)                                  \
+    (*(saida) = (heap)->estatisticas, (saida)->instrumentada = 1)
+#define HEAP_PUBLICO_ZERAR_ESTATISTICAS(heap)                                          \
+    ((heap) != NULL                                                                    \
+         ? (void) memset(&(heap)->estatisticas, 0, sizeof((heap)->estatisticas))       \
+         : (void) 0)
+#else
+#define PACIENTE_MAIOR_INSTRUMENTADO PACIENTE_MAIOR
+#define PACIENTE_MENOR_INSTRUMENTADO PACIENTE_MENOR
+#define HEAP_PUBLICO_CONTAR_CRESCIMENTO(heap) ((void) 0)
+#define HEAP_PUBLICO_COPIAR_ESTATISTICAS(heap, saida) ((void) memset((saida), 0, sizeof(*(saida))))
+#define HEAP_PUBLICO_ZERAR_ESTATISTICAS(heap) ((void) (heap))
+#endif
+
+// Bytes do array próprio atual (o motor aloca ao menos uma posição)
+#define HEAP_PUBLICO_BYTES_ARRAY(heap) \
+    ((size_t) ((heap)->capacidade > 0 ? (heap)->capacidade : 1) * sizeof(Paciente))
+
+// O array pode estar no mesmo bloco da struct, em memória do chamador ou em
+// uma arena (ver heap_generico.h)
+#define HEAP_ARRAY_EMPRESTADO(heap) ((heap)->arrayEmprestado)
+#define HEAP_ASSUMIR_ARRAY(heap) ((heap)->arrayEmprestado = 0)
+// O array próprio pode estar em páginas grandes (definirPaginas*Heap)
+#define HEAP_REALOCAR(heap, atual, bytes) \
+    realocarPaginas((atual), HEAP_PUBLICO_BYTES_ARRAY(heap), (bytes), (heap)->paginas)
+
+#include "heap_generico/heap_generico.h"
+
+/**
+ * @brief Gera o motor e a API pública de uma heap de Pacientes. Toda a lógica
+ * de heapify, crescimento, inserção em lote e inserção adiada vive em
+ * heap_generico.h; as funções geradas são apenas a API pública. Toda operação
+ * que não seja inserir ou espiar começa consolidando os pendentes.
+ */
+#define HEAP_GERAR_PUBLICO(Sufixo, prefixo, ORDEM)                                     \
+                                                                                       \
+HEAP_GERAR(prefixo##Heap, Sufixo##Heap, Paciente, ORDEM##_INSTRUMENTADO)               \
+HEAP_GERAR_ADIADO(prefixo##Heap, Sufixo##Heap, Paciente, ORDEM##_INSTRUMENTADO)        \
+                                                                                       \
+/* Libera o array próprio (nunca um emprestado) */                                     \
+static void liberarArray##Sufixo(Sufixo##Heap *heap) {                                 \
+    if (!heap->arrayEmprestado) {                                                      \
+        liberarPaginas(heap->array, HEAP_PUBLICO_BYTES_ARRAY(heap), heap->paginas);    \
+    }                                                                                  \
+}                                                                                      \
+                                                                                       \
+/* Layout de bloco único: struct e array contíguos em uma só alocação. O campo */      \
+/* 'array' aponta para 'dados' até a heap crescer além deles. */                       \
+typedef struct {                                                                       \
+    Sufixo##Heap heap;                                                                 \
+    Paciente dados[];                                                                  \
+} Bloco##Sufixo##Heap;                                                                 \
+                                                                                       \
+/* Bytes de um Bloco##Sufixo##Heap com 'capacidade' pacientes (0 se não couber em size_t). */ \
+static size_t bytesBloco##Sufixo(HeapIndice capacidade) {                              \
+    if ((size_t) capacidade > (SIZE_MAX - sizeof(Bloco##Sufixo##Heap)) / sizeof(Paciente)) return 0; \
+    return sizeof(Bloco##Sufixo##Heap) + (size_t) capacidade * sizeof(Paciente);       \
+}                                                                                      \
+                                                                                       \
+/* Prepara a heap de um Bloco##Sufixo##Heap recém-alocado. */                          \
+static Sufixo##Heap* montarBloco##Sufixo(Bloco##Sufixo##Heap *bloco, HeapIndice capacidade, int expansivel) { \
+    Sufixo##Heap *heap = &bloco->heap;                                                 \
+    memset(heap, 0, sizeof(*heap));                                                    \
+    heap->array = bloco->dados;                                                        \
+    heap->capacidade = capacidade;                                                     \
+    heap->expansivel = expansivel;                                                     \
+    heap->arrayEmprestado = 1;                                                         \
+    return heap;                                                                       \
+}                                                                                      \
+                                                                                       \
+Sufixo##Heap* criar##Sufixo##Heap(HeapIndice capacidade) {                             \
+    if (capacidade < 0) capacidade = 0;                                                \
+    size_t bytes = bytesBloco##Sufixo(capacidade);                                     \
+    Bloco##Sufixo##Heap *bloco = bytes > 0 ? (Bloco##Sufixo##Heap*) malloc(bytes) : NULL; \
+    if (bloco == NULL) {                                                               \
+        perror("Falha ao alocar memória para heap (" #Sufixo "Heap)");                 \
+        return NULL;                                                                   \
+    }                                                                                  \
+    return montarBloco##Sufixo(bloco, capacidade, 0);                                  \
+}                                                                                      \
+                                                                                       \
+Sufixo##Heap* criar##Sufixo##HeapExpansivel(HeapIndice capacidadeInicial) {            \
+    Sufixo##Heap *heap = criar##Sufixo##Heap(capacidadeInicial);                       \
+    if (heap != NULL) {                                                                \
+        heap->expansivel = 1;                                                          \
+    }                                                                                  \
+    return heap;                                                                       \
+}                                                                                      \
+                                                                                       \
+int inicializar##Sufixo##Heap(Sufixo##Heap *heap, Paciente armazenamento[], HeapIndice capacidade, int expansivel) { \
+    if (heap == NULL || capacidade < 0 || (armazenamento == NULL && capacidade > 0)) { \
+        return HEAP_ERRO_PARAMETRO;                                                    \
+    }                                                                                  \
+    memset(heap, 0, sizeof(*heap));                                                    \
+    heap->array = armazenamento;                                                       \
+    heap->capacidade = capacidade;                                                     \
+    heap->expansivel = expansivel;                                                     \
+    heap->arrayEmprestado = 1;                                                         \
+    return HEAP_OK;                                                                    \
+}                                                                                      \
+                                                                                       \
+void finalizar##Sufixo##Heap(Sufixo##Heap *heap) {                                     \
+    if (heap == NULL) return;                                                          \
+    liberarArray##Sufixo(heap);                                                        \
+    heap->array = NULL;                                                                \
+    heap->tamanho = 0;                                                                 \
+    heap->capacidade = 0;                                                              \
+    heap->arrayEmprestado = 1;                                                         \
+    heap->pendentes = 0;                                                               \
+}                                                                                      \
+                                                                                       \
+/* Adaptador de finalizar##Sufixo##Heap para o finalizador da arena. */                \
+static void finalizar##Sufixo##HeapArena(void *heap) {                                 \
+    finalizar##Sufixo##Heap((Sufixo##Heap*) heap);                                     \
+}                                                                                      \
+                                                                                       \
+Sufixo##Heap* criar##Sufixo##HeapNaArena(ArenaHeaps *arena, HeapIndice capacidade, int expansivel) { \
+    if (arena == NULL || capacidade < 0) return NULL;                                  \
+    size_t bytes = bytesBloco##Sufixo(capacidade);                                     \
+    Bloco##Sufixo##Heap *bloco = bytes > 0 ? (Bloco##Sufixo##Heap*) alocarArenaHeaps(arena, bytes) : NULL; \
+    if (bloco == NULL) return NULL;                                                    \
+    /* Mesmo heaps de capacidade fixa podem ganhar um array próprio (reservar...Heap) */ \
+    if (registrarFinalizadorArenaHeaps(arena, finalizar##Sufixo##HeapArena, &bloco->heap) != HEAP_OK) { \
+        return NULL;                                                                   \
+    }                                                                                  \
+    return montarBloco##Sufixo(bloco, capacidade, expansivel);                         \
+}                                                                                      \
+                                                                                       \
+int inserirPaciente##Sufixo(Sufixo##Heap *heap, Paciente p) {                          \
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;                                      \
+    HEAP_INSTRUMENTAR_INICIO(contadoresPublico, heap);                                 \
+    int status = heap->insercaoAdiada ? prefixo##HeapInserirAdiado(heap, p) : prefixo##HeapInserir(heap, p); \
+    HEAP_INSTRUMENTAR_FIM(contadoresPublico, heap, HEAP_OP_INSERIR, 1, status);        \
+    return status;                                                                     \
+}                                                                                      \
+                                                                                       \
+int reservar##Sufixo##Heap(Sufixo##Heap *heap, HeapIndice capacidade) {                \
+    if (heap == NULL || capacidade < 0) return HEAP_ERRO_PARAMETRO;                    \
+    HEAP_INSTRUMENTAR_INICIO(contadoresPublico, heap);                                 \
+    int status = prefixo##HeapReservar(heap, capacidade);                              \
+    HEAP_PUBLICO_CONTAR_CRESCIMENTO(heap);                                             \
+    return status;                                                                     \
+}                                                                                      \
+                                                                                       \
+int encolher##Sufixo##Heap(Sufixo##Heap *heap) {                                       \
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;                                      \
+    return prefixo##HeapEncolher(heap);                                                \
+}                                                                                      \
+                                                                                       \
+int definirInsercaoAdiada##Sufixo##Heap(Sufixo##Heap *heap, int adiada) {              \
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;                                      \
+    if (!adiada) {                                                                     \
+        prefixo##HeapConsolidar(heap);                                                 \
+    }                                                                                  \
+    heap->insercaoAdiada = adiada != 0;                                                \
+    return HEAP_OK;                                                                    \
+}                                                                                      \
+                                                                                       \
+int definirPaginas##Sufixo##Heap(Sufixo##Heap *heap, ModoPaginas modo) {               \
+    if (heap == NULL || modo < PAGINAS_NORMAIS || modo > PAGINAS_EXPLICITAS) return HEAP_ERRO_PARAMETRO; \
+    if (modo == heap->paginas) return HEAP_OK;                                         \
+    if (!heap->arrayEmprestado && heap->array != NULL) {                               \
+        size_t bytes = HEAP_PUBLICO_BYTES_ARRAY(heap);                                 \
+        Paciente *novo = (Paciente*) realocarPaginas(NULL, 0, bytes, modo);            \
+        if (novo == NULL) return HEAP_ERRO_MEMORIA;                                    \
+        if (heap->tamanho > 0) {                                                       \
+            memcpy(novo, heap->array, (size_t) heap->tamanho * sizeof(Paciente));      \
+        }                                                                              \
+        liberarArray##Sufixo(heap);                                                    \
+        heap->array = novo;                                                            \
+    }                                                                                  \
+    heap->paginas = modo;                                                              \
+    return HEAP_OK;                                                                    \
+}                                                                                      \
+                                                                                       \
+Sufixo##Heap* criar##Sufixo##HeapDeArray(Paciente array[], HeapIndice n, int adotar) { \
+    if (n < 0 || n > HEAP_TAMANHO_MAX || (array == NULL && n > 0)) return NULL;        \
+    Sufixo##Heap *heap;                                                                \
+    if (adotar) {                                                                      \
+        heap = (Sufixo##Heap*) calloc(1, sizeof(Sufixo##Heap));                        \
+        if (heap == NULL) {                                                            \
+            perror("Falha ao alocar memória para heap (" #Sufixo "Heap)");             \
+            return NULL;                                                               \
+        }                                                                              \
+        heap->array = array;                                                           \
+        heap->capacidade = n;                                                          \
+        heap->expansivel = 1;                                                          \
+    } else {                                                                           \
+        heap = criar##Sufixo##HeapExpansivel(n);                                       \
+        if (heap == NULL) return NULL;                                                 \
+        if (n > 0) {                                                                   \
+            memcpy(heap->array, array, (size_t) n * sizeof(Paciente));                 \
+        }                                                                              \
+    }                                                                                  \
+    heap->tamanho = n;                                                                 \
+    prefixo##HeapConstruir(heap->array, n);                                            \
+    return heap;                                                                       \
+}                                                                                      \
+                                                                                       \
+int inserirLote##Sufixo(Sufixo##Heap *heap, const Paciente lote[], HeapIndice k) {     \
+    if (heap == NULL || k < 0 || (lote == NULL && k > 0)) return HEAP_ERRO_PARAMETRO;  \
+    HEAP_INSTRUMENTAR_INICIO(contadoresPublico, heap);                                 \
+    prefixo##HeapConsolidar(heap);                                                     \
+    int status = prefixo##HeapInserirLote(heap, lote, k);                              \
+    HEAP_INSTRUMENTAR_FIM(contadoresPublico, heap, HEAP_OP_LOTE, 0, status);           \
+    return status;                                                                     \
+}                                                                                      \
+                                                                                       \
+/* Troca arrays, tamanhos e capacidades de duas heaps. */                              \
+static void trocarConteudo##Sufixo(Sufixo##Heap *a, Sufixo##Heap *b) {                 \
+    Sufixo##Heap temp = *a;                                                            \
+    a->array = b->array;                                                               \
+    a->tamanho = b->tamanho;                                                           \
+    a->capacidade = b->capacidade;                                                     \
+    a->paginas = b->paginas;                                                           \
+    b->array = temp.array;                                                             \
+    b->tamanho = temp.tamanho;                                                         \
+    b->capacidade = temp.capacidade;                                                   \
+    b->paginas = temp.paginas;                                                         \
+}                                                                                      \
+                                                                                       \
+int fundir##Sufixo##Heaps(Sufixo##Heap *destino, Sufixo##Heap *origem) {               \
+    if (destino == NULL || origem == NULL || destino == origem) return HEAP_ERRO_PARAMETRO; \
+    /* Só arrays próprios podem mudar de dono: um array emprestado continua */         \
+    /* preso ao bloco (ou à memória) de onde veio */                                   \
+    int trocados = origem->tamanho > destino->tamanho && destino->expansivel && origem->expansivel \
+                && !destino->arrayEmprestado && !origem->arrayEmprestado;              \
+    prefixo##HeapConsolidar(destino);                                                  \
+    prefixo##HeapConsolidar(origem);                                                   \
+    if (trocados) {                                                                    \
+        trocarConteudo##Sufixo(destino, origem); /* Copia a menor para o array da maior */ \
+    }                                                                                  \
+    HEAP_INSTRUMENTAR_INICIO(contadoresPublico, destino);                              \
+    int status = prefixo##HeapInserirLote(destino, origem->array, origem->tamanho);    \
+    HEAP_INSTRUMENTAR_FIM(contadoresPublico, destino, HEAP_OP_LOTE, 0, status);        \
+    if (status == HEAP_OK) {                                                           \
+        origem->tamanho = 0;                                                           \
+    } else if (trocados) {                                                             \
+        trocarConteudo##Sufixo(destino, origem);                                       \
+    }                                                                                  \
+    return status;                                                                     \
+}                                                                                      \
+                                                                                       \
+Paciente espiar##Sufixo##PacienteHeap(const Sufixo##Heap *heap) {                      \
+    Paciente pVazio = {-1, -1};                                                        \
+    Paciente topo;                                                                     \
+    if (heap == NULL || !prefixo##HeapEspiar(heap, &topo)) {                           \
+        return pVazio;                                                                 \
+    }                                                                                  \
+    return topo;                                                                       \
+}                                                                                      \
+                                                                                       \
+Paciente extrair##Sufixo##PacienteHeap(Sufixo##Heap *heap) {                           \
+    Paciente pVazio = {-1, -1};                                                        \
+    Paciente raiz;                                                                     \
+    if (heap == NULL) {                                                                \
+        return pVazio;                                                                 \
+    }                                                                                  \
+    HEAP_INSTRUMENTAR_INICIO(contadoresPublico, heap);                                 \
+    prefixo##HeapConsolidar(heap);                                                     \
+    int extraido = prefixo##HeapExtrair(heap, &raiz);                                  \
+    HEAP_INSTRUMENTAR_FIM(contadoresPublico, heap, HEAP_OP_EXTRAIR, 1, HEAP_OK);       \
+    return extraido ? raiz : pVazio;                                                   \
+}                                                                                      \
+                                                                                       \
+HeapIndice extrairLote##Sufixo(Sufixo##Heap *heap, HeapIndice k, Paciente saida[]) {   \
+    if (heap == NULL || k < 0 || (saida == NULL && k > 0)) return HEAP_ERRO_PARAMETRO; \
+    HEAP_INSTRUMENTAR_INICIO(contadoresPublico, heap);                                 \
+    prefixo##HeapConsolidar(heap);                                                     \
+    HeapIndice extraidos = prefixo##HeapExtrairLote(heap, k, saida);                   \
+    HEAP_INSTRUMENTAR_FIM(contadoresPublico, heap, HEAP_OP_LOTE, 0, HEAP_OK);          \
+    return extraidos;                                                                  \
+}                                                                                      \
+                                                                                       \
+int obterEstatisticas##Sufixo##Heap(const Sufixo##Heap *heap, EstatisticasHeap *saida) { \
+    if (heap == NULL || saida == NULL) return HEAP_ERRO_PARAMETRO;                     \
+    HEAP_PUBLICO_COPIAR_ESTATISTICAS(heap, saida);                                     \
+    return HEAP_OK;                                                                    \
+}                                                                                      \
+                                                                                       \
+void zerarEstatisticas##Sufixo##Heap(Sufixo##Heap *heap) {                             \
+    HEAP_PUBLICO_ZERAR_ESTATISTICAS(heap);                                             \
+}                                                                                      \
+                                                                                       \
+int prefixo##HeapVazia(Sufixo##Heap *heap) {                                           \
+    if (heap == NULL) return 1;                                                        \
+    return heap->tamanho == 0;                                                         \
+}                                                                                      \
+                                                                                       \
+void liberar##Sufixo##Heap(Sufixo##Heap *heap) {                                       \
+    if (heap != NULL) {                                                                \
+        liberarArray##Sufixo(heap);                                                    \
+        free(heap);                                                                    \
+    }                                                                                  \
+}
+
+#endif // HEAP_PUBLICO_H
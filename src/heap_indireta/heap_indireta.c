@@ -0,0 +1,180 @@
+#include "heap_indireta.h"
+#include <stdio.h>  // perror
+#include <stdlib.h> // Para malloc, realloc, free
+#include <string.h> // memcpy, memset
+
+// Ordem das entradas: só a prioridade, como a MaxHeap de Pacientes
+#define ENTRADA_INDIRETA_MAIOR(a, b) ((a).prioridade > (b).prioridade)
+#include "heap_generico/heap_generico.h"
+
+// Instancia o motor genérico sobre os pares (prioridade, referência)
+HEAP_GERAR(heapIndireta, HeapIndireta, EntradaIndireta, ENTRADA_INDIRETA_MAIOR)
+
+// Estado de cada referência já entregue
+enum {
+    REGISTRO_LIVRE = 0, // Slot na lista de livres
+    REGISTRO_NA_HEAP,   // Registro vivo e com entrada na heap
+    REGISTRO_EXTRAIDO   // Registro vivo, já fora da heap (aguarda liberarRegistroHeapIndireta)
+};
+
+// Funções auxiliares estáticas
+
+/**
+ * @brief Endereço do slot 'ref' (bloco ref >> HEAP_INDIRETA_BITS_BLOCO).
+ */
+static unsigned char* slotIndireto(const HeapIndireta *heap, RefRegistro ref) {
+    return heap->blocos[ref >> HEAP_INDIRETA_BITS_BLOCO]
+         + (size_t) (ref & (HEAP_INDIRETA_REGISTROS_POR_BLOCO - 1)) * heap->bytesSlot;
+}
+
+/**
+ * @brief Aloca mais um bloco do slab (e o espaço de estados correspondente).
+ */
+static int crescerSlab(HeapIndireta *heap) {
+    if (heap->numBlocos >= (REF_REGISTRO_INVALIDA >> HEAP_INDIRETA_BITS_BLOCO)) return HEAP_ERRO_CHEIA;
+    size_t referencias = (size_t) (heap->numBlocos + 1) * HEAP_INDIRETA_REGISTROS_POR_BLOCO;
+    unsigned char **blocos = (unsigned char**) realloc(heap->blocos,
+                                                       (size_t) (heap->numBlocos + 1) * sizeof(unsigned char*));
+    if (blocos == NULL) return HEAP_ERRO_MEMORIA;
+    heap->blocos = blocos;
+    unsigned char *estados = (unsigned char*) realloc(heap->estados, referencias);
+    if (estados == NULL) return HEAP_ERRO_MEMORIA;
+    heap->estados = estados;
+    // Os blocos ficam onde foram alocados: os registros não mudam de endereço
+    unsigned char *bloco = (unsigned char*) malloc(HEAP_INDIRETA_REGISTROS_POR_BLOCO * heap->bytesSlot);
+    if (bloco == NULL) return HEAP_ERRO_MEMORIA;
+    heap->blocos[heap->numBlocos++] = bloco;
+    return HEAP_OK;
+}
+
+/**
+ * @brief Tira um slot do slab: primeiro da lista de livres, depois do fim.
+ */
+static int alocarSlot(HeapIndireta *heap, RefRegistro *ref) {
+    if (heap->livres != REF_REGISTRO_INVALIDA) {
+        *ref = heap->livres;
+        memcpy(&heap->livres, slotIndireto(heap, *ref), sizeof(RefRegistro));
+        return HEAP_OK;
+    }
+    if (heap->usados == REF_REGISTRO_INVALIDA) return HEAP_ERRO_CHEIA;
+    if (heap->usados == heap->numBlocos * HEAP_INDIRETA_REGISTROS_POR_BLOCO) {
+        int status = crescerSlab(heap);
+        if (status != HEAP_OK) return status;
+    }
+    *ref = heap->usados++;
+    return HEAP_OK;
+}
+
+// Implementações das funções públicas
+
+HeapIndireta* criarHeapIndireta(size_t bytesRegistro) {
+    if (bytesRegistro == 0 || bytesRegistro > SIZE_MAX / HEAP_INDIRETA_REGISTROS_POR_BLOCO) return NULL;
+    HeapIndireta *heap = (HeapIndireta*) calloc(1, sizeof(HeapIndireta));
+    if (heap == NULL) {
+        perror("Falha ao alocar memória para heap (HeapIndireta)");
+        return NULL;
+    }
+    if (heapIndiretaInicializar(heap, 0, 1) != HEAP_OK) {
+        free(heap);
+        return NULL;
+    }
+    heap->bytesRegistro = bytesRegistro;
+    heap->bytesSlot = bytesRegistro < sizeof(RefRegistro) ? sizeof(RefRegistro) : bytesRegistro;
+    heap->livres = REF_REGISTRO_INVALIDA;
+    return heap;
+}
+
+int inserirHeapIndireta(HeapIndireta *heap, int prioridade, const void *registro, RefRegistro *ref) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    RefRegistro novo;
+    int status = alocarSlot(heap, &novo);
+    if (status != HEAP_OK) return status;
+    EntradaIndireta entrada = {prioridade, novo};
+    status = heapIndiretaInserir(heap, entrada);
+    if (status != HEAP_OK) {
+        memcpy(slotIndireto(heap, novo), &heap->livres, sizeof(RefRegistro));
+        heap->livres = novo;
+        heap->estados[novo] = REGISTRO_LIVRE;
+        return status;
+    }
+    unsigned char *slot = slotIndireto(heap, novo);
+    if (registro != NULL) {
+        memcpy(slot, registro, heap->bytesRegistro);
+    } else {
+        memset(slot, 0, heap->bytesRegistro);
+    }
+    heap->estados[novo] = REGISTRO_NA_HEAP;
+    heap->registros++;
+    if (ref != NULL) *ref = novo;
+    return HEAP_OK;
+}
+
+void* registroHeapIndireta(const HeapIndireta *heap, RefRegistro ref) {
+    if (heap == NULL || ref >= heap->usados || heap->estados[ref] == REGISTRO_LIVRE) return NULL;
+    return slotIndireto(heap, ref);
+}
+
+RefRegistro espiarMaxHeapIndireta(const HeapIndireta *heap, int *prioridade) {
+    if (heap == NULL || heap->tamanho == 0) return REF_REGISTRO_INVALIDA;
+    if (prioridade != NULL) *prioridade = heap->array[0].prioridade;
+    return heap->array[0].ref;
+}
+
+RefRegistro extrairMaxHeapIndireta(HeapIndireta *heap, int *prioridade) {
+    EntradaIndireta raiz;
+    if (heap == NULL || !heapIndiretaExtrair(heap, &raiz)) return REF_REGISTRO_INVALIDA;
+    heap->estados[raiz.ref] = REGISTRO_EXTRAIDO;
+    if (prioridade != NULL) *prioridade = raiz.prioridade;
+    return raiz.ref;
+}
+
+int liberarRegistroHeapIndireta(HeapIndireta *heap, RefRegistro ref) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    if (ref >= heap->usados || heap->estados[ref] == REGISTRO_LIVRE) return HEAP_ERRO_NAO_ENCONTRADO;
+    if (heap->estados[ref] == REGISTRO_NA_HEAP) return HEAP_ERRO_PARAMETRO;
+    memcpy(slotIndireto(heap, ref), &heap->livres, sizeof(RefRegistro));
+    heap->livres = ref;
+    heap->estados[ref] = REGISTRO_LIVRE;
+    heap->registros--;
+    return HEAP_OK;
+}
+
+int heapIndiretaVazia(const HeapIndireta *heap) {
+    if (heap == NULL) return 1;
+    return heap->tamanho == 0;
+}
+
+void liberarHeapIndireta(HeapIndireta *heap) {
+    if (heap == NULL) return;
+    for (uint32_t b = 0; b < heap->numBlocos; b++) {
+        free(heap->blocos[b]);
+    }
+    free(heap->blocos);
+    free(heap->estados);
+    free(heap->array);
+    free(heap);
+}
+
+int heapsortIndireto(const void *registros, HeapIndice n, size_t bytesRegistro,
+                     size_t deslocamentoPrioridade, uint32_t permutacao[]) {
+    if (n < 0 || (n > 0 && (registros == NULL || permutacao == NULL))) return HEAP_ERRO_PARAMETRO;
+    if ((uint64_t) n > REF_REGISTRO_INVALIDA || deslocamentoPrioridade + sizeof(int) > bytesRegistro) {
+        return HEAP_ERRO_PARAMETRO;
+    }
+    if (n == 0) return HEAP_OK;
+    if ((size_t) n > SIZE_MAX / sizeof(EntradaIndireta)) return HEAP_ERRO_MEMORIA;
+    EntradaIndireta *pares = (EntradaIndireta*) malloc((size_t) n * sizeof(EntradaIndireta));
+    if (pares == NULL) return HEAP_ERRO_MEMORIA;
+    const unsigned char *base = (const unsigned char*) registros;
+    for (HeapIndice i = 0; i < n; i++) {
+        // memcpy: o campo pode não estar alinhado se o chamador empacotar os registros
+        memcpy(&pares[i].prioridade, base + (size_t) i * bytesRegistro + deslocamentoPrioridade, sizeof(int));
+        pares[i].ref = (uint32_t) i;
+    }
+    heapIndiretaOrdenar(pares, n);
+    for (HeapIndice i = 0; i < n; i++) {
+        permutacao[i] = pares[i].ref;
+    }
+    free(pares);
+    return HEAP_OK;
+}
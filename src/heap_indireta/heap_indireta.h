@@ -0,0 +1,131 @@
+#ifndef HEAP_INDIRETA_H
+#define HEAP_INDIRETA_H
+
+#include <stddef.h> // size_t
+#include <stdint.h> // uint32_t
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+#include "includes/heap_indice.h" // HeapIndice (int ou 64 bits com HEAP_LARGA_ESCALA)
+
+// Max-Heap indireta para registros grandes (ex.: RegistroPaciente). Os
+// registros ficam em um slab de blocos, com endereço fixo, e a heap ordena só
+// pares (prioridade, referência de 32 bits): cada nível de heapify move 8
+// bytes, qualquer que seja o tamanho do registro.
+
+// Registros por bloco do slab (potência de 2)
+#define HEAP_INDIRETA_BITS_BLOCO 10
+#define HEAP_INDIRETA_REGISTROS_POR_BLOCO (1u << HEAP_INDIRETA_BITS_BLOCO)
+
+// Referência estável a um registro do slab (válida até liberarRegistroHeapIndireta)
+typedef uint32_t RefRegistro;
+#define REF_REGISTRO_INVALIDA UINT32_MAX
+
+// Entrada da heap: a chave e onde está o registro
+typedef struct {
+    int prioridade;
+    RefRegistro ref;
+} EntradaIndireta;
+
+typedef struct {
+    EntradaIndireta *array; // Heap de entradas (motor genérico)
+    HeapIndice tamanho;     // Entradas na heap
+    HeapIndice capacidade;  // Capacidade do array de entradas
+    int expansivel;         // Sempre 1
+    size_t bytesRegistro;   // Tamanho pedido de cada registro
+    size_t bytesSlot;       // bytesRegistro, ou sizeof(RefRegistro) se menor (lista de livres)
+    unsigned char **blocos; // Blocos de HEAP_INDIRETA_REGISTROS_POR_BLOCO slots
+    unsigned char *estados; // Estado de cada referência já entregue (livre, na heap, extraído)
+    uint32_t numBlocos;     // Blocos alocados
+    uint32_t usados;        // Referências já entregues alguma vez (as seguintes nunca foram usadas)
+    RefRegistro livres;     // Lista de slots devolvidos, reaproveitados antes de novos
+    HeapIndice registros;   // Registros vivos (na heap ou extraídos e ainda não liberados)
+} HeapIndireta;
+
+/**
+ * @brief Cria uma Max-Heap indireta vazia, expansível.
+ * @param bytesRegistro Tamanho de cada registro (ex.: sizeof(RegistroPaciente)).
+ * @return Ponteiro para a HeapIndireta criada, ou NULL em caso de falha
+ * (inclusive bytesRegistro 0).
+ */
+HeapIndireta* criarHeapIndireta(size_t bytesRegistro);
+
+/**
+ * @brief Copia o registro para um slot do slab (reaproveitando um devolvido,
+ * se houver) e insere o par (prioridade, referência) na heap.
+ * @param heap Ponteiro para a HeapIndireta.
+ * @param prioridade A chave do registro.
+ * @param registro Os bytesRegistro a copiar (NULL deixa o slot zerado, para
+ * ser preenchido por registroHeapIndireta).
+ * @param ref Recebe a referência do registro (pode ser NULL).
+ * @return HEAP_OK, HEAP_ERRO_CHEIA (2^32 - 1 referências em uso),
+ * HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirHeapIndireta(HeapIndireta *heap, int prioridade, const void *registro, RefRegistro *ref);
+
+/**
+ * @brief Localiza um registro pela referência em O(1). O endereço não muda
+ * enquanto o registro estiver vivo.
+ * @param heap Ponteiro para a HeapIndireta.
+ * @param ref A referência devolvida por inserirHeapIndireta.
+ * @return O registro, ou NULL se a referência não estiver viva.
+ */
+void* registroHeapIndireta(const HeapIndireta *heap, RefRegistro ref);
+
+/**
+ * @brief Retorna, sem remover, a referência do registro de maior prioridade.
+ * @param heap Ponteiro para a HeapIndireta.
+ * @param prioridade Recebe a prioridade (pode ser NULL).
+ * @return A referência, ou REF_REGISTRO_INVALIDA se a heap estiver vazia.
+ */
+RefRegistro espiarMaxHeapIndireta(const HeapIndireta *heap, int *prioridade);
+
+/**
+ * @brief Remove da heap o registro de maior prioridade sem copiá-lo: ele
+ * continua no slab, acessível por registroHeapIndireta, até ser devolvido
+ * com liberarRegistroHeapIndireta.
+ * @param heap Ponteiro para a HeapIndireta.
+ * @param prioridade Recebe a prioridade (pode ser NULL).
+ * @return A referência, ou REF_REGISTRO_INVALIDA se a heap estiver vazia.
+ */
+RefRegistro extrairMaxHeapIndireta(HeapIndireta *heap, int *prioridade);
+
+/**
+ * @brief Devolve ao slab o slot de um registro já extraído.
+ * @param heap Ponteiro para a HeapIndireta.
+ * @param ref A referência devolvida por extrairMaxHeapIndireta.
+ * @return HEAP_OK, HEAP_ERRO_NAO_ENCONTRADO (referência não viva) ou
+ * HEAP_ERRO_PARAMETRO (o registro ainda está na heap).
+ */
+int liberarRegistroHeapIndireta(HeapIndireta *heap, RefRegistro ref);
+
+/**
+ * @brief Verifica se a heap indireta está vazia (registros extraídos e ainda
+ * não liberados não contam).
+ * @param heap Ponteiro para a HeapIndireta.
+ * @return 1 se a heap estiver vazia, 0 caso contrário.
+ */
+int heapIndiretaVazia(const HeapIndireta *heap);
+
+/**
+ * @brief Libera a heap, o slab e todos os registros ainda vivos.
+ * @param heap Ponteiro para a HeapIndireta.
+ */
+void liberarHeapIndireta(HeapIndireta *heap);
+
+/**
+ * @brief Heapsort indireto: ordena por prioridade crescente os índices de um
+ * array de registros grandes, sem mover os registros. Ordena pares
+ * (prioridade, índice de 32 bits) e escreve em 'permutacao' os índices na
+ * ordem final, de modo que registros[permutacao[0]] tem a menor prioridade.
+ * Assim como heapsortPacientes, não é estável.
+ * @param registros O array de registros.
+ * @param n Número de registros (até 2^32 - 1).
+ * @param bytesRegistro Tamanho de cada registro.
+ * @param deslocamentoPrioridade Posição do campo int de prioridade no
+ * registro (ex.: offsetof(RegistroPaciente, paciente.prioridade)).
+ * @param permutacao Recebe os n índices.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int heapsortIndireto(const void *registros, HeapIndice n, size_t bytesRegistro,
+                     size_t deslocamentoPrioridade, uint32_t permutacao[]);
+
+#endif // HEAP_INDIRETA_H
@@ -0,0 +1,217 @@
+#include "heap_min_max.h"
+#include "heap_generico/heap_generico.h"
+
+// Crescimento e inicialização vêm do motor genérico; a ordem passada
+// não é usada, pois o heapify da heap min-max alterna a ordem por nível.
+HEAP_GERAR(heapMinMax, HeapMinMax, Paciente, PACIENTE_MENOR)
+
+/**
+ * @brief Retorna 1 se o nó i está em um nível de mínimo (nível par).
+ * O nível de i é floor(log2(i + 1)).
+ */
+static inline int nivelMinimo(int i) {
+    unsigned int posicao = (unsigned int) i + 1u;
+    int nivel = 0;
+    while (posicao > 1u) {
+        posicao >>= 1;
+        nivel++;
+    }
+    return (nivel & 1) == 0;
+}
+
+/**
+ * @brief Sobe x a partir do buraco em i comparando só com os avós: com
+ * ANTES = PACIENTE_MENOR percorre os níveis de mínimo, com PACIENTE_MAIOR os
+ * de máximo.
+ */
+#define HEAP_MIN_MAX_SUBIR_AVOS(nome, ANTES)                                           \
+static void nome(Paciente array[], int i, Paciente x) {                                \
+    while (i > 2) {                                                                    \
+        int avo = heapPai(heapPai(i));                                                 \
+        if (!ANTES(x, array[avo])) {                                                   \
+            break;                                                                     \
+        }                                                                              \
+        HEAP_MOVER(array[i], array[avo]);                                              \
+        i = avo;                                                                       \
+    }                                                                                  \
+    HEAP_MOVER(array[i], x);                                                           \
+}
+
+/**
+ * @brief Desce x a partir do buraco em i (um nó de nível de mínimo com
+ * ANTES = PACIENTE_MENOR, de máximo com PACIENTE_MAIOR). A cada passo escolhe
+ * o "mais extremo" entre filhos e netos; se for um neto, x passa por baixo do
+ * pai desse neto, trocando com ele se ficar do lado errado.
+ */
+#define HEAP_MIN_MAX_DESCER(nome, ANTES)                                               \
+static void nome(Paciente array[], int n, int i, Paciente x) {                         \
+    for (;;) {                                                                         \
+        int primeiroFilho = heapFilhoEsquerda(i);                                      \
+        if (primeiroFilho >= n) {                                                      \
+            break;                                                                     \
+        }                                                                              \
+        int m = primeiroFilho;                                                         \
+        if (primeiroFilho + 1 < n && ANTES(array[primeiroFilho + 1], array[m])) {      \
+            m = primeiroFilho + 1;                                                     \
+        }                                                                              \
+        int primeiroNeto = heapFilhoEsquerda(primeiroFilho);                           \
+        for (int j = primeiroNeto; j < primeiroNeto + 4 && j < n; j++) {               \
+            if (ANTES(array[j], array[m])) {                                           \
+                m = j;                                                                 \
+            }                                                                          \
+        }                                                                              \
+        if (!ANTES(array[m], x)) {                                                     \
+            break;                                                                     \
+        }                                                                              \
+        HEAP_MOVER(array[i], array[m]);                                                \
+        if (m < primeiroNeto) {                                                        \
+            i = m; /* Filho: seus descendentes já estão do lado certo de x */         \
+            break;                                                                     \
+        }                                                                              \
+        int pai = heapPai(m);                                                          \
+        if (ANTES(array[pai], x)) {                                                    \
+            Paciente t = array[pai];                                                   \
+            HEAP_MOVER(array[pai], x);                                                 \
+            x = t;                                                                     \
+        }                                                                              \
+        i = m;                                                                         \
+    }                                                                                  \
+    HEAP_MOVER(array[i], x);                                                           \
+}
+
+HEAP_MIN_MAX_SUBIR_AVOS(subirMinimo, PACIENTE_MENOR)
+HEAP_MIN_MAX_SUBIR_AVOS(subirMaximo, PACIENTE_MAIOR)
+HEAP_MIN_MAX_DESCER(descerMinimo, PACIENTE_MENOR)
+HEAP_MIN_MAX_DESCER(descerMaximo, PACIENTE_MAIOR)
+
+/**
+ * @brief Coloca x no buraco i (última posição) e restaura a heap: primeiro
+ * decide, pelo pai, se x pertence aos níveis de mínimo ou de máximo.
+ */
+static void subirMinMax(Paciente array[], int i, Paciente x) {
+    if (i == 0) {
+        HEAP_MOVER(array[0], x);
+        return;
+    }
+    int pai = heapPai(i);
+    if (nivelMinimo(i)) {
+        if (PACIENTE_MAIOR(x, array[pai])) {
+            HEAP_MOVER(array[i], array[pai]);
+            subirMaximo(array, pai, x);
+        } else {
+            subirMinimo(array, i, x);
+        }
+    } else {
+        if (PACIENTE_MENOR(x, array[pai])) {
+            HEAP_MOVER(array[i], array[pai]);
+            subirMinimo(array, pai, x);
+        } else {
+            subirMaximo(array, i, x);
+        }
+    }
+}
+
+// Índice do maior paciente (heap não vazia): a raiz ou um dos seus filhos
+static int indiceMaximo(const HeapMinMax *heap) {
+    if (heap->tamanho == 1) {
+        return 0;
+    }
+    if (heap->tamanho > 2 && PACIENTE_MAIOR(heap->array[2], heap->array[1])) {
+        return 2;
+    }
+    return 1;
+}
+
+static HeapMinMax* criarHeapMinMaxInterna(int capacidade, int expansivel) {
+    HeapMinMax *heap = (HeapMinMax*) malloc(sizeof(HeapMinMax));
+    if (heap == NULL) {
+        perror("Falha ao alocar memória para heap (HeapMinMax)");
+        return NULL;
+    }
+    if (heapMinMaxInicializar(heap, capacidade, expansivel) != HEAP_OK) {
+        perror("Falha ao alocar memória para o array da heap (HeapMinMax)");
+        free(heap);
+        return NULL;
+    }
+    return heap;
+}
+
+HeapMinMax* criarHeapMinMax(int capacidade) {
+    if (capacidade <= 0) return NULL;
+    return criarHeapMinMaxInterna(capacidade, 0);
+}
+
+HeapMinMax* criarHeapMinMaxExpansivel(int capacidadeInicial) {
+    if (capacidadeInicial < 0) return NULL;
+    return criarHeapMinMaxInterna(capacidadeInicial, 1);
+}
+
+int inserirPacienteMinMax(HeapMinMax *heap, Paciente p) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    if (heap->tamanho == INT_MAX) return HEAP_ERRO_CHEIA;
+    int status = heapMinMaxGarantir(heap, heap->tamanho + 1);
+    if (status != HEAP_OK) {
+        return status;
+    }
+    heap->tamanho++;
+    subirMinMax(heap->array, heap->tamanho - 1, p);
+    return HEAP_OK;
+}
+
+Paciente espiarMaxPacienteMinMax(const HeapMinMax *heap) {
+    Paciente pVazio = {-1, -1};
+    if (heap == NULL || heap->tamanho == 0) {
+        return pVazio;
+    }
+    return heap->array[indiceMaximo(heap)];
+}
+
+Paciente espiarMinPacienteMinMax(const HeapMinMax *heap) {
+    Paciente pVazio = {-1, -1};
+    if (heap == NULL || heap->tamanho == 0) {
+        return pVazio;
+    }
+    return heap->array[0];
+}
+
+Paciente extrairMaxPacienteMinMax(HeapMinMax *heap) {
+    Paciente pVazio = {-1, -1};
+    if (heap == NULL || heap->tamanho == 0) {
+        return pVazio;
+    }
+    int i = indiceMaximo(heap);
+    Paciente maior = heap->array[i];
+    heap->tamanho--;
+    if (i < heap->tamanho) {
+        if (i == 0) {
+            descerMinimo(heap->array, heap->tamanho, 0, heap->array[heap->tamanho]);
+        } else {
+            descerMaximo(heap->array, heap->tamanho, i, heap->array[heap->tamanho]);
+        }
+    }
+    return maior;
+}
+
+Paciente extrairMinPacienteMinMax(HeapMinMax *heap) {
+    Paciente pVazio = {-1, -1};
+    if (heap == NULL || heap->tamanho == 0) {
+        return pVazio;
+    }
+    Paciente menor = heap->array[0];
+    heap->tamanho--;
+    if (heap->tamanho > 0) {
+        descerMinimo(heap->array, heap->tamanho, 0, heap->array[heap->tamanho]);
+    }
+    return menor;
+}
+
+int heapMinMaxVazia(const HeapMinMax *heap) {
+    return heap == NULL || heap->tamanho == 0;
+}
+
+void liberarHeapMinMax(HeapMinMax *heap) {
+    if (heap != NULL) {
+        free(heap->array);
+        free(heap);
+    }
+}
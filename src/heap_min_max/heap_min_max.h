@@ -0,0 +1,92 @@
+#ifndef HEAP_MIN_MAX_H
+#define HEAP_MIN_MAX_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Heap min-max (Atkinson et al.): fila de prioridade dupla em um único array.
+// Os níveis pares (a raiz é o nível 0) são "de mínimo" e os ímpares "de
+// máximo": cada nó de nível de mínimo é menor ou igual a todos os seus
+// descendentes, e cada nó de nível de máximo é maior ou igual. O menor
+// paciente fica na raiz e o maior em um dos seus dois filhos, de modo que as
+// duas extremidades são extraídas em O(log n) sem manter uma MaxHeap e uma
+// MinHeap paralelas.
+
+// Estrutura da heap min-max (mesmos campos das heaps do motor genérico)
+typedef struct {
+    Paciente *array; // Ponteiro para o array de pacientes
+    int tamanho;     // Número atual de pacientes na heap
+    int capacidade;  // Capacidade atual do array
+    int expansivel;  // 1 se o array cresce automaticamente quando cheio
+} HeapMinMax;
+
+/**
+ * @brief Cria uma nova heap min-max de capacidade fixa.
+ * @param capacidade A capacidade máxima da heap.
+ * @return Ponteiro para a HeapMinMax criada, ou NULL em caso de falha.
+ */
+HeapMinMax* criarHeapMinMax(int capacidade);
+
+/**
+ * @brief Cria uma nova heap min-max que dobra de capacidade quando cheia.
+ * @param capacidadeInicial Capacidade inicial do array (pode ser 0).
+ * @return Ponteiro para a HeapMinMax criada, ou NULL em caso de falha.
+ */
+HeapMinMax* criarHeapMinMaxExpansivel(int capacidadeInicial);
+
+/**
+ * @brief Insere um paciente na heap min-max em O(log n).
+ * @param heap Ponteiro para a HeapMinMax.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_CHEIA, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacienteMinMax(HeapMinMax *heap, Paciente p);
+
+/**
+ * @brief Retorna, sem remover, o paciente de maior prioridade (O(1)).
+ * @param heap Ponteiro para a HeapMinMax.
+ * @return O Paciente de maior prioridade. Se a heap estiver vazia, retorna um
+ * Paciente com id e prioridade -1.
+ */
+Paciente espiarMaxPacienteMinMax(const HeapMinMax *heap);
+
+/**
+ * @brief Retorna, sem remover, o paciente de menor prioridade (O(1)).
+ * @param heap Ponteiro para a HeapMinMax.
+ * @return O Paciente de menor prioridade. Se a heap estiver vazia, retorna um
+ * Paciente com id e prioridade -1.
+ */
+Paciente espiarMinPacienteMinMax(const HeapMinMax *heap);
+
+/**
+ * @brief Remove e retorna o paciente de maior prioridade em O(log n).
+ * @param heap Ponteiro para a HeapMinMax.
+ * @return O Paciente extraído. Se a heap estiver vazia, retorna um Paciente
+ * com id e prioridade -1.
+ */
+Paciente extrairMaxPacienteMinMax(HeapMinMax *heap);
+
+/**
+ * @brief Remove e retorna o paciente de menor prioridade em O(log n).
+ * @param heap Ponteiro para a HeapMinMax.
+ * @return O Paciente extraído. Se a heap estiver vazia, retorna um Paciente
+ * com id e prioridade -1.
+ */
+Paciente extrairMinPacienteMinMax(HeapMinMax *heap);
+
+/**
+ * @brief Verifica se a heap min-max está vazia.
+ * @param heap Ponteiro para a HeapMinMax.
+ * @return 1 se a heap estiver vazia, 0 caso contrário.
+ */
+int heapMinMaxVazia(const HeapMinMax *heap);
+
+/**
+ * @brief Libera a memória alocada para a heap min-max.
+ * @param heap Ponteiro para a HeapMinMax a ser liberada.
+ */
+void liberarHeapMinMax(HeapMinMax *heap);
+
+#endif // HEAP_MIN_MAX_H
@@ -0,0 +1,282 @@
+#include "heap_persistente.h"
+#include "heap_generico/heap_generico.h"
+#include <string.h> // memcmp, memcpy
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(_WIN32) || !defined(__GNUC__)
+#error "heap_persistente requer POSIX (mmap) e GCC ou Clang"
+#endif
+
+#define HEAP_PERSISTENTE_MAGICA "HEAPPAC1"
+#define HEAP_PERSISTENTE_VERSAO 1
+
+// O cabeçalho deve ocupar exatamente uma página de 4 KiB
+typedef char cabecalhoOcupaUmaPagina[sizeof(CabecalhoHeapPersistente) == 4096 ? 1 : -1];
+
+// Ordena as gravações no mapeamento: o registro de desfazer precisa estar
+// completo antes de a operação começar, e a operação antes de o registro ser
+// descartado.
+#define BARREIRA() __atomic_thread_fence(__ATOMIC_SEQ_CST)
+
+HEAP_GERAR_ARRAY(persistenteMax, Paciente, PACIENTE_MAIOR)
+HEAP_GERAR_ARRAY(persistenteMin, Paciente, PACIENTE_MENOR)
+
+// Funções auxiliares estáticas
+
+static int antesPersistente(const HeapPersistente *heap, Paciente a, Paciente b) {
+    return heap->cabecalho->tipo == HEAP_PERSISTENTE_MAX ? PACIENTE_MAIOR(a, b) : PACIENTE_MENOR(a, b);
+}
+
+/**
+ * @brief Mapeia 'bytes' do arquivo aberto e atualiza os ponteiros da heap.
+ * @return 1 em caso de sucesso, 0 em caso de falha (mapeamento anterior mantido).
+ */
+static int mapearHeap(HeapPersistente *heap, size_t bytes) {
+    void *mapa = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, heap->descritor, 0);
+    if (mapa == MAP_FAILED) {
+        return 0;
+    }
+    if (heap->cabecalho != NULL) {
+        munmap(heap->cabecalho, heap->bytesMapeados);
+    }
+    heap->cabecalho = (CabecalhoHeapPersistente*) mapa;
+    heap->array = (Paciente*) (heap->cabecalho + 1);
+    heap->bytesMapeados = bytes;
+    return 1;
+}
+
+static size_t bytesParaCapacidade(int64_t capacidade) {
+    return sizeof(CabecalhoHeapPersistente) + (size_t) capacidade * sizeof(Paciente);
+}
+
+/**
+ * @brief Dobra a capacidade: o arquivo cresce primeiro e a nova capacidade só
+ * é gravada no cabeçalho depois de o novo mapeamento existir.
+ */
+static int crescerHeapPersistente(HeapPersistente *heap) {
+    int64_t capacidade = heap->cabecalho->capacidade;
+    int64_t nova = capacidade > 0 ? capacidade * 2 : 16;
+    if (nova > INT32_MAX) {
+        nova = INT32_MAX;
+    }
+    if (nova <= capacidade) {
+        return HEAP_ERRO_CHEIA;
+    }
+    size_t bytes = bytesParaCapacidade(nova);
+    if (ftruncate(heap->descritor, (off_t) bytes) != 0 || !mapearHeap(heap, bytes)) {
+        return HEAP_ERRO_ARQUIVO;
+    }
+    heap->cabecalho->capacidade = nova;
+    return HEAP_OK;
+}
+
+/**
+ * @brief Grava no cabeçalho os valores atuais das posições que a operação vai
+ * sobrescrever e marca a operação como pendente.
+ */
+static void registrarDesfazer(HeapPersistente *heap, const int posicoes[], int quantidade) {
+    CabecalhoHeapPersistente *c = heap->cabecalho;
+    for (int i = 0; i < quantidade; i++) {
+        c->posicoes[i] = posicoes[i];
+        c->valores[i] = heap->array[posicoes[i]];
+    }
+    c->numDesfazer = (uint32_t) quantidade;
+    c->tamanhoAnterior = c->tamanho;
+    BARREIRA();
+    c->operacaoPendente = 1;
+    BARREIRA();
+}
+
+static void concluirOperacao(HeapPersistente *heap) {
+    BARREIRA();
+    heap->cabecalho->operacaoPendente = 0;
+}
+
+/**
+ * @brief Desfaz uma operação interrompida (chamado ao abrir o arquivo).
+ */
+static void recuperarHeapPersistente(HeapPersistente *heap) {
+    CabecalhoHeapPersistente *c = heap->cabecalho;
+    if (!c->operacaoPendente) {
+        return;
+    }
+    for (int i = (int) c->numDesfazer - 1; i >= 0; i--) {
+        heap->array[c->posicoes[i]] = c->valores[i];
+    }
+    c->tamanho = c->tamanhoAnterior;
+    concluirOperacao(heap);
+}
+
+/**
+ * @brief Valida um cabeçalho lido do arquivo de tamanho 'bytesArquivo'.
+ */
+static int cabecalhoValido(const CabecalhoHeapPersistente *c, TipoHeapPersistente tipo, size_t bytesArquivo) {
+    return memcmp(c->magica, HEAP_PERSISTENTE_MAGICA, sizeof(c->magica)) == 0 &&
+           c->versao == HEAP_PERSISTENTE_VERSAO && c->tipo == (uint32_t) tipo &&
+           c->capacidade >= 0 && c->capacidade <= INT32_MAX &&
+           c->tamanho >= 0 && c->tamanho <= c->capacidade &&
+           c->numDesfazer <= HEAP_PERSISTENTE_MAX_DESFAZER &&
+           bytesParaCapacidade(c->capacidade) <= bytesArquivo;
+}
+
+HeapPersistente* abrirHeapPersistente(const char *caminho, TipoHeapPersistente tipo, int capacidadeInicial) {
+    if (caminho == NULL || capacidadeInicial < 0) {
+        return NULL;
+    }
+    HeapPersistente *heap = (HeapPersistente*) malloc(sizeof(HeapPersistente));
+    if (heap == NULL) {
+        perror("Falha ao alocar memória para heap (HeapPersistente)");
+        return NULL;
+    }
+    heap->cabecalho = NULL;
+    heap->array = NULL;
+    heap->bytesMapeados = 0;
+    heap->descritor = open(caminho, O_RDWR | O_CREAT, 0644);
+    struct stat info;
+    if (heap->descritor < 0 || fstat(heap->descritor, &info) != 0) {
+        perror("Falha ao abrir o arquivo da heap persistente");
+        if (heap->descritor >= 0) close(heap->descritor);
+        free(heap);
+        return NULL;
+    }
+
+    // Arquivo vazio, ou criação interrompida antes de a mágica ser gravada: o
+    // arquivo já tem o tamanho do cabeçalho mais a capacidade pedida e a
+    // mágica ainda é toda zero. Qualquer outro arquivo sem a mágica é rejeitado
+    // abaixo, sem ser alterado.
+    size_t bytes = bytesParaCapacidade(capacidadeInicial);
+    char magica[sizeof(((CabecalhoHeapPersistente*) 0)->magica)];
+    static const char magicaZerada[sizeof(magica)] = {0};
+    int criacaoInterrompida = (size_t) info.st_size == bytes &&
+        pread(heap->descritor, magica, sizeof(magica), 0) == (ssize_t) sizeof(magica) &&
+        memcmp(magica, magicaZerada, sizeof(magica)) == 0;
+    if (info.st_size == 0 || criacaoInterrompida) {
+        // Arquivo novo: cabeçalho zerado pelo ftruncate (ou pelo memset, se a
+        // criação anterior já tinha estendido o arquivo)
+        if ((info.st_size == 0 && ftruncate(heap->descritor, (off_t) bytes) != 0) || !mapearHeap(heap, bytes)) {
+            perror("Falha ao criar o arquivo da heap persistente");
+            close(heap->descritor);
+            free(heap);
+            return NULL;
+        }
+        memset(heap->cabecalho, 0, sizeof(CabecalhoHeapPersistente));
+        CabecalhoHeapPersistente *c = heap->cabecalho;
+        c->versao = HEAP_PERSISTENTE_VERSAO;
+        c->tipo = (uint32_t) tipo;
+        c->tamanho = 0;
+        c->capacidade = capacidadeInicial;
+        BARREIRA();
+        memcpy(c->magica, HEAP_PERSISTENTE_MAGICA, sizeof(c->magica)); // Gravada por último
+        return heap;
+    }
+
+    size_t bytesArquivo = (size_t) info.st_size;
+    CabecalhoHeapPersistente lido;
+    if (bytesArquivo < sizeof(lido) || pread(heap->descritor, &lido, sizeof(lido), 0) != (ssize_t) sizeof(lido) ||
+        !cabecalhoValido(&lido, tipo, bytesArquivo) || !mapearHeap(heap, bytesParaCapacidade(lido.capacidade))) {
+        fprintf(stderr, "Arquivo de heap persistente inválido ou de outro tipo: %s\n", caminho);
+        close(heap->descritor);
+        free(heap);
+        return NULL;
+    }
+    recuperarHeapPersistente(heap);
+    return heap;
+}
+
+int inserirPacientePersistente(HeapPersistente *heap, Paciente p) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    if (heap->cabecalho->tamanho == heap->cabecalho->capacidade) {
+        int status = crescerHeapPersistente(heap);
+        if (status != HEAP_OK) return status;
+    }
+
+    // Posições gravadas pelo heapify-up: os ancestrais que descem e a posição final de p
+    int n = (int) heap->cabecalho->tamanho;
+    int caminho[HEAP_PERSISTENTE_MAX_DESFAZER];
+    int quantidade = 0;
+    int index = n;
+    caminho[quantidade++] = index;
+    while (index > 0 && antesPersistente(heap, p, heap->array[heapPai(index)])) {
+        index = heapPai(index);
+        caminho[quantidade++] = index;
+    }
+    registrarDesfazer(heap, caminho, quantidade);
+
+    heap->cabecalho->tamanho = n + 1;
+    if (heap->cabecalho->tipo == HEAP_PERSISTENTE_MAX) {
+        persistenteMaxSubirValor(heap->array, n, p);
+    } else {
+        persistenteMinSubirValor(heap->array, n, p);
+    }
+    concluirOperacao(heap);
+    return HEAP_OK;
+}
+
+Paciente extrairPacientePersistente(HeapPersistente *heap) {
+    Paciente pVazio = {-1, -1};
+    if (heap == NULL || heap->cabecalho->tamanho == 0) {
+        return pVazio;
+    }
+    Paciente raiz = heap->array[0];
+    int n = (int) heap->cabecalho->tamanho - 1;
+    Paciente x = heap->array[n];
+
+    // Posições gravadas pelo heapify-down: o caminho do melhor filho até a posição final de x
+    int caminho[HEAP_PERSISTENTE_MAX_DESFAZER];
+    int quantidade = 0;
+    int index = 0;
+    int filho;
+    caminho[quantidade++] = index;
+    while ((filho = heapFilhoEsquerda(index)) < n) {
+        if (filho + 1 < n && antesPersistente(heap, heap->array[filho + 1], heap->array[filho])) {
+            filho++;
+        }
+        if (!antesPersistente(heap, heap->array[filho], x)) {
+            break;
+        }
+        index = filho;
+        caminho[quantidade++] = index;
+    }
+    registrarDesfazer(heap, caminho, n > 0 ? quantidade : 0);
+
+    heap->cabecalho->tamanho = n;
+    if (n > 0) {
+        if (heap->cabecalho->tipo == HEAP_PERSISTENTE_MAX) {
+            persistenteMaxDescerValor(heap->array, n, 0, x);
+        } else {
+            persistenteMinDescerValor(heap->array, n, 0, x);
+        }
+    }
+    concluirOperacao(heap);
+    return raiz;
+}
+
+int tamanhoHeapPersistente(HeapPersistente *heap) {
+    if (heap == NULL) return 0;
+    return (int) heap->cabecalho->tamanho;
+}
+
+int heapPersistenteVazia(HeapPersistente *heap) {
+    if (heap == NULL) return 1;
+    return heap->cabecalho->tamanho == 0;
+}
+
+int sincronizarHeapPersistente(HeapPersistente *heap) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    if (msync(heap->cabecalho, heap->bytesMapeados, MS_SYNC) != 0 || fsync(heap->descritor) != 0) {
+        return HEAP_ERRO_ARQUIVO;
+    }
+    return HEAP_OK;
+}
+
+void fecharHeapPersistente(HeapPersistente *heap) {
+    if (heap != NULL) {
+        sincronizarHeapPersistente(heap);
+        munmap(heap->cabecalho, heap->bytesMapeados);
+        close(heap->descritor);
+        free(heap);
+    }
+}
@@ -0,0 +1,104 @@
+#ifndef HEAP_PERSISTENTE_H
+#define HEAP_PERSISTENTE_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include <stdint.h> // int32_t, uint32_t, int64_t
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Máximo de posições no registro de desfazer (caminho raiz-folha de uma heap com índices int)
+#define HEAP_PERSISTENTE_MAX_DESFAZER 32
+
+// Ordem da heap persistente
+typedef enum {
+    HEAP_PERSISTENTE_MAX, // Extrai a maior prioridade (como MaxHeap)
+    HEAP_PERSISTENTE_MIN  // Extrai a menor prioridade (como MinHeap)
+} TipoHeapPersistente;
+
+// Cabeçalho no início do arquivo, seguido pelo array de Pacientes. Ocupa uma
+// página inteira para que o array comece alinhado.
+typedef struct {
+    char magica[8];             // "HEAPPAC1"
+    uint32_t versao;
+    uint32_t tipo;              // TipoHeapPersistente
+    int64_t tamanho;            // Número atual de pacientes
+    int64_t capacidade;         // Pacientes que cabem no arquivo
+    // Registro de desfazer da operação em andamento: valores antigos das
+    // posições que a operação vai sobrescrever.
+    uint32_t operacaoPendente;  // 1 entre o registro e o fim da operação
+    uint32_t numDesfazer;
+    int64_t tamanhoAnterior;
+    int32_t posicoes[HEAP_PERSISTENTE_MAX_DESFAZER];
+    Paciente valores[HEAP_PERSISTENTE_MAX_DESFAZER];
+    char reservado[4096 - 48 - HEAP_PERSISTENTE_MAX_DESFAZER * (4 + 8)];
+} CabecalhoHeapPersistente;
+
+// Heap cujo cabeçalho e array vivem em um arquivo mapeado em memória (mmap):
+// reabrir o arquivo devolve a heap pronta, sem reconstrução.
+typedef struct {
+    CabecalhoHeapPersistente *cabecalho; // Início do mapeamento
+    Paciente *array;                     // Logo após o cabeçalho
+    size_t bytesMapeados;
+    int descritor;                       // Arquivo aberto
+} HeapPersistente;
+
+/**
+ * @brief Abre (ou cria) uma heap persistente no arquivo 'caminho'.
+ * Se o arquivo já existir, é validado e mapeado como está; se o processo
+ * anterior foi interrompido no meio de uma operação, ela é desfeita com o
+ * registro de desfazer do cabeçalho, e a heap volta ao estado logo anterior.
+ * Requer POSIX (mmap).
+ * @param caminho Caminho do arquivo.
+ * @param tipo HEAP_PERSISTENTE_MAX ou HEAP_PERSISTENTE_MIN (deve coincidir com
+ * o do arquivo existente).
+ * @param capacidadeInicial Capacidade de um arquivo novo (ignorada se ele existir).
+ * @return Ponteiro para a HeapPersistente, ou NULL em caso de falha.
+ */
+HeapPersistente* abrirHeapPersistente(const char *caminho, TipoHeapPersistente tipo, int capacidadeInicial);
+
+/**
+ * @brief Insere um paciente. Quando cheio, o arquivo e o mapeamento dobram de tamanho.
+ * @param heap Ponteiro para a HeapPersistente.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_ARQUIVO (falha ao crescer o arquivo) ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacientePersistente(HeapPersistente *heap, Paciente p);
+
+/**
+ * @brief Extrai o paciente de maior (Max) ou menor (Min) prioridade.
+ * @param heap Ponteiro para a HeapPersistente.
+ * @return O Paciente extraído. Se a heap estiver vazia, retorna um Paciente
+ * com id e prioridade -1.
+ */
+Paciente extrairPacientePersistente(HeapPersistente *heap);
+
+/**
+ * @brief Retorna o número de pacientes na heap persistente.
+ * @param heap Ponteiro para a HeapPersistente.
+ */
+int tamanhoHeapPersistente(HeapPersistente *heap);
+
+/**
+ * @brief Verifica se a heap persistente está vazia.
+ * @param heap Ponteiro para a HeapPersistente.
+ * @return 1 se a heap estiver vazia, 0 caso contrário.
+ */
+int heapPersistenteVazia(HeapPersistente *heap);
+
+/**
+ * @brief Ponto de controle: grava no disco (msync + fsync) todas as operações
+ * concluídas até aqui. Sem ele, as operações sobrevivem a uma queda do
+ * processo, mas não necessariamente a uma queda do sistema.
+ * @param heap Ponteiro para a HeapPersistente.
+ * @return HEAP_OK, HEAP_ERRO_ARQUIVO ou HEAP_ERRO_PARAMETRO.
+ */
+int sincronizarHeapPersistente(HeapPersistente *heap);
+
+/**
+ * @brief Sincroniza, desfaz o mapeamento e fecha o arquivo.
+ * @param heap Ponteiro para a HeapPersistente a ser fechada.
+ */
+void fecharHeapPersistente(HeapPersistente *heap);
+
+#endif // HEAP_PERSISTENTE_H
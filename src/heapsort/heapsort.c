@@ -1,26 +1,302 @@
 #include "heapsort.h" // Já inclui max_heap.h transitivamente
+#ifdef HEAP_INSTRUMENTACAO
+// Contadores das instâncias do motor deste arquivo; HEAP_MOVER precisa ser
+// definido antes da inclusão de heap_generico.h.
+static HEAP_LOCAL_THREAD ContadoresHeap contadoresHeapsort;
+#define HEAP_MOVER(destino, origem) (contadoresHeapsort.movimentos++, (destino) = (origem))
+#define PACIENTE_ANTES_HEAPSORT(a, b) (contadoresHeapsort.comparacoes++, PACIENTE_MAIOR(a, b))
+#define CHAVE_MAIOR(a, b) (contadoresHeapsort.comparacoes++, (a) > (b))
+#else
+#define PACIENTE_ANTES_HEAPSORT PACIENTE_MAIOR
+#define CHAVE_MAIOR(a, b) ((a) > (b))
+#endif
+#include "heap_generico/heap_generico.h"
+#include "heap_estavel/heap_estavel.h" // Chaves empacotadas de 64 bits
+#include <string.h> // memcpy
+#if defined(HEAP_INSTRUMENTACAO) && defined(HEAP_TEM_THREADS)
+#include <pthread.h> // Trava das estatísticas
+#endif
 
-// Não precisamos mais das versões estáticas de trocarHeapsort e heapifyDownHeapsort aqui,
-// pois usaremos as versões públicas de max_heap.c
+// Instância do motor genérico só com as operações sobre array (Max-Heap,
+// resultando em ordem ascendente).
+HEAP_GERAR_ARRAY(heapsortMax, Paciente, PACIENTE_ANTES_HEAPSORT)
 
-void heapsortPacientes(Paciente array[], int n) {
-    if (n <= 1) {
+// Instância sobre chaves de 64 bits para o Heapsort estável
+HEAP_GERAR_ARRAY(heapsortChave, uint64_t, CHAVE_MAIOR)
+
+#ifdef HEAP_INSTRUMENTACAO
+// Estatísticas globais do Heapsort; as ordenações são feitas sem a trava e só
+// a soma final a toma (ordenarPacientesParalelo ordena blocos em threads).
+// Sem threads não há ordenação concorrente, e a trava não é necessária.
+static EstatisticasHeap estatisticasHeapsort;
+#ifdef HEAP_TEM_THREADS
+static pthread_mutex_t travaEstatisticasHeapsort = PTHREAD_MUTEX_INITIALIZER;
+#define TRAVAR_ESTATISTICAS() pthread_mutex_lock(&travaEstatisticasHeapsort)
+#define DESTRAVAR_ESTATISTICAS() pthread_mutex_unlock(&travaEstatisticasHeapsort)
+#else
+#define TRAVAR_ESTATISTICAS() ((void) 0)
+#define DESTRAVAR_ESTATISTICAS() ((void) 0)
+#endif
+
+static void registrarOrdenacao(const MarcaInstrumentacao *marca) {
+    EstatisticasHeap parcela;
+    memset(&parcela, 0, sizeof(parcela));
+    instrumentacaoRegistrar(&parcela, marca, &contadoresHeapsort, HEAP_OP_ORDENAR, 0);
+    TRAVAR_ESTATISTICAS();
+    instrumentacaoSomar(&estatisticasHeapsort, &parcela);
+    DESTRAVAR_ESTATISTICAS();
+}
+#endif
+
+int obterEstatisticasHeapsort(EstatisticasHeap *saida) {
+    if (saida == NULL) return HEAP_ERRO_PARAMETRO;
+#ifdef HEAP_INSTRUMENTACAO
+    TRAVAR_ESTATISTICAS();
+    *saida = estatisticasHeapsort;
+    DESTRAVAR_ESTATISTICAS();
+    saida->instrumentada = 1;
+#else
+    memset(saida, 0, sizeof(*saida));
+#endif
+    return HEAP_OK;
+}
+
+void zerarEstatisticasHeapsort(void) {
+#ifdef HEAP_INSTRUMENTACAO
+    TRAVAR_ESTATISTICAS();
+    memset(&estatisticasHeapsort, 0, sizeof(estatisticasHeapsort));
+    DESTRAVAR_ESTATISTICAS();
+#endif
+}
+
+void heapsortPacientes(Paciente array[], HeapIndice n) {
+    heapsortPacientesModo(array, n, HEAPSORT_CLASSICO);
+}
+
+void heapsortPacientesModo(Paciente array[], HeapIndice n, ModoHeapsort modo) {
+    if (array == NULL || n <= 1) {
         return;
     }
+#ifdef HEAP_INSTRUMENTACAO
+    MarcaInstrumentacao marca;
+    instrumentacaoIniciar(&marca, &contadoresHeapsort);
+#endif
+    if (modo == HEAPSORT_BOTTOM_UP) {
+        heapsortMaxOrdenarBottomUp(array, n);
+    } else {
+        heapsortMaxOrdenar(array, n);
+    }
+#ifdef HEAP_INSTRUMENTACAO
+    registrarOrdenacao(&marca);
+#endif
+}
+
+int heapsortPacientesEstavel(Paciente array[], HeapIndice n) {
+    if (array == NULL || n < 0 || (uint64_t) n > UINT32_MAX) {
+        return HEAP_ERRO_PARAMETRO;
+    }
+    if (n <= 1) {
+        return HEAP_OK;
+    }
+    if ((size_t) n > SIZE_MAX / sizeof(uint64_t) || (size_t) n > SIZE_MAX / sizeof(Paciente)) {
+        return HEAP_ERRO_MEMORIA;
+    }
+    uint64_t *chaves = (uint64_t*) malloc((size_t) n * sizeof(uint64_t));
+    Paciente *copia = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+    if (chaves == NULL || copia == NULL) {
+        free(chaves);
+        free(copia);
+        return HEAP_ERRO_MEMORIA;
+    }
+    for (HeapIndice i = 0; i < n; i++) {
+        chaves[i] = chaveEstavelCrescente(array[i].prioridade, (uint32_t) i);
+    }
+#ifdef HEAP_INSTRUMENTACAO
+    MarcaInstrumentacao marca;
+    instrumentacaoIniciar(&marca, &contadoresHeapsort);
+#endif
+    heapsortChaveOrdenarBottomUp(chaves, n);
+#ifdef HEAP_INSTRUMENTACAO
+    registrarOrdenacao(&marca);
+#endif
 
-    // 1. Construir a Max-Heap (reorganizar o array)
-    // Chama a função heapifyDownMaxArray exposta por max_heap.c
-    for (int i = n / 2 - 1; i >= 0; i--) {
-        heapifyDownMaxArray(array, n, i);
+    memcpy(copia, array, (size_t) n * sizeof(Paciente));
+    for (HeapIndice i = 0; i < n; i++) {
+        array[i] = copia[(uint32_t) chaves[i]];
     }
+    free(chaves);
+    free(copia);
+    return HEAP_OK;
+}
+
+#ifndef HEAP_TEM_THREADS
+// Sem threads (heapsort_paralelo.c não é compilado), a ordenação é sequencial
+void ordenarPacientesParalelo(Paciente array[], HeapIndice n, int threads) {
+    (void) threads;
+    heapsortPacientes(array, n);
+}
+#endif
+
+// Dígitos do radix sort: até 11 bits, para que os histogramas (2^11 contadores)
+// caibam no cache L1; 32 bits de chave pedem no máximo 3 passadas.
+#define RADIX_BITS_MAXIMO 11
+#define RADIX_PASSADAS_MAXIMO 3
 
-    // 2. Extrair elementos um por um da heap
-    for (int i = n - 1; i > 0; i--) {
-        // Mover a raiz atual (maior elemento) para o final do array
-        // Chama a função trocarPacientes exposta por max_heap.c
-        trocarPacientes(&array[0], &array[i]);
+// ordenarPacientes só usa o radix sort com ao menos 1 elemento para cada
+// RADIX_CONTADORES_POR_ELEMENTO contadores de histograma (passadas * 2^largura):
+// abaixo disso, zerar e somar os histogramas custa mais que o Heapsort.
+// Medido no bench_heap (seção radix): o radix passa a ganhar perto de n = 128
+// com prioridades de 0 a 999 (1 passada de 10 bits) e de n = 600 com 31 bits.
+#define RADIX_CONTADORES_POR_ELEMENTO 8
+
+/**
+ * @brief Prioridade como chave sem sinal: com o bit de sinal invertido, a
+ * ordem dos uint32_t é a mesma dos int.
+ */
+static inline uint32_t chaveRadix(Paciente p) {
+    return (uint32_t) p.prioridade ^ 0x80000000u;
+}
+
+/**
+ * @brief Menor chave e amplitude (maior - menor) das chaves do array.
+ */
+static void faixaChavesRadix(const Paciente array[], HeapIndice n, uint32_t *minimo, uint32_t *amplitude) {
+    uint32_t menor = chaveRadix(array[0]);
+    uint32_t maior = menor;
+    for (HeapIndice i = 1; i < n; i++) {
+        uint32_t chave = chaveRadix(array[i]);
+        if (chave < menor) menor = chave;
+        if (chave > maior) maior = chave;
+    }
+    *minimo = menor;
+    *amplitude = maior - menor;
+}
+
+/**
+ * @brief Bits significativos de 'amplitude' (os únicos que variam entre as chaves).
+ */
+static int bitsRadix(uint32_t amplitude) {
+    int bits = 0;
+    while (bits < 32 && (amplitude >> bits) != 0) {
+        bits++;
+    }
+    return bits;
+}
 
-        // Chamar heapifyDownMaxArray na heap reduzida
-        heapifyDownMaxArray(array, i, 0);
+/**
+ * @brief Número de passadas de até RADIX_BITS_MAXIMO bits para 'bits' bits de chave.
+ */
+static int passadasRadix(int bits) {
+    return (bits + RADIX_BITS_MAXIMO - 1) / RADIX_BITS_MAXIMO;
+}
+
+/**
+ * @brief Largura dos dígitos: iguais entre as passadas (20 bits viram 2
+ * passadas de 10, não 11 + 9), o que encolhe os histogramas.
+ */
+static int larguraRadix(int bits, int passadas) {
+    return (bits + passadas - 1) / passadas;
+}
+
+/**
+ * @brief Radix sort LSD das chaves (chave - minimo), alternando entre 'array'
+ * e 'auxiliar'; o resultado termina em 'array'.
+ */
+static void radixOrdenar(Paciente array[], Paciente auxiliar[], HeapIndice n,
+                         uint32_t minimo, uint32_t amplitude) {
+    int bits = bitsRadix(amplitude);
+    int passadas = passadasRadix(bits);
+    if (passadas == 0) {
+        return; // Todas as prioridades são iguais
+    }
+    int largura = larguraRadix(bits, passadas);
+    uint32_t mascara = (1u << largura) - 1u;
+
+    // Todos os histogramas em uma única leitura do array (só os dígitos usados
+    // são zerados: em arrays pequenos, zerar 2^11 contadores custaria mais que ordenar)
+    HeapIndice contagem[RADIX_PASSADAS_MAXIMO][1 << RADIX_BITS_MAXIMO];
+    for (int d = 0; d < passadas; d++) {
+        memset(contagem[d], 0, ((size_t) mascara + 1) * sizeof(HeapIndice));
+    }
+    for (HeapIndice i = 0; i < n; i++) {
+        uint32_t chave = chaveRadix(array[i]) - minimo;
+        for (int d = 0; d < passadas; d++) {
+            contagem[d][(chave >> (d * largura)) & mascara]++;
+        }
+    }
+
+    Paciente *origem = array;
+    Paciente *destino = auxiliar;
+    for (int d = 0; d < passadas; d++) {
+        int deslocamento = d * largura;
+        HeapIndice *posicao = contagem[d];
+        // Dígito igual em todos os pacientes: a passada não mudaria nada
+        if (posicao[((chaveRadix(origem[0]) - minimo) >> deslocamento) & mascara] == n) {
+            continue;
+        }
+        HeapIndice soma = 0;
+        for (uint32_t digito = 0; digito <= mascara; digito++) {
+            HeapIndice quantidade = posicao[digito];
+            posicao[digito] = soma;
+            soma += quantidade;
+        }
+        for (HeapIndice i = 0; i < n; i++) {
+            Paciente p = origem[i];
+            destino[posicao[((chaveRadix(p) - minimo) >> deslocamento) & mascara]++] = p;
+        }
+        Paciente *troca = origem;
+        origem = destino;
+        destino = troca;
+    }
+    if (origem != array) {
+        memcpy(array, origem, (size_t) n * sizeof(Paciente));
+    }
+}
+
+int radixSortPacientes(Paciente array[], HeapIndice n) {
+    if (array == NULL || n < 0) {
+        return HEAP_ERRO_PARAMETRO;
+    }
+    if (n <= 1) {
+        return HEAP_OK;
+    }
+    if ((size_t) n > SIZE_MAX / sizeof(Paciente)) {
+        return HEAP_ERRO_MEMORIA;
+    }
+    Paciente *auxiliar = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+    if (auxiliar == NULL) {
+        return HEAP_ERRO_MEMORIA;
+    }
+    uint32_t minimo;
+    uint32_t amplitude;
+    faixaChavesRadix(array, n, &minimo, &amplitude);
+    radixOrdenar(array, auxiliar, n, minimo, amplitude);
+    free(auxiliar);
+    return HEAP_OK;
+}
+
+void ordenarPacientes(Paciente array[], HeapIndice n) {
+    if (array == NULL || n <= 1) {
+        return;
+    }
+    uint32_t minimo;
+    uint32_t amplitude;
+    faixaChavesRadix(array, n, &minimo, &amplitude);
+    int bits = bitsRadix(amplitude);
+    int passadas = passadasRadix(bits);
+    if (passadas == 0) {
+        return; // Todas as prioridades são iguais: já está ordenado
+    }
+    HeapIndice contadores = (HeapIndice) passadas << larguraRadix(bits, passadas);
+    Paciente *auxiliar = NULL;
+    if (n >= ORDENACAO_RADIX_MINIMO && n >= contadores / RADIX_CONTADORES_POR_ELEMENTO
+        && (size_t) n <= SIZE_MAX / sizeof(Paciente)) {
+        auxiliar = (Paciente*) malloc((size_t) n * sizeof(Paciente));
+    }
+    if (auxiliar == NULL) {
+        heapsortPacientes(array, n); // Pequeno ou sem memória: in-place
+        return;
     }
-}
\ No newline at end of file
+    radixOrdenar(array, auxiliar, n, minimo, amplitude);
+    free(auxiliar);
+}
@@ -4,14 +4,113 @@
 // Inclui max_heap.h para ter acesso à struct Paciente e às novas funções públicas
 #include "max_heap/max_heap.h"
 
+// Variantes do Heapsort
+typedef enum {
+    HEAPSORT_CLASSICO,  // Desce o último elemento a partir da raiz (2 comparações por nível)
+    HEAPSORT_BOTTOM_UP  // Wegener: desce o buraco até uma folha e sobe o elemento (~metade das comparações)
+} ModoHeapsort;
+
 /**
  * @brief Ordena um array de Pacientes usando o algoritmo Heapsort.
  * A ordenação é feita in-place e em ordem ascendente de prioridade.
- * Utiliza funções do módulo max_heap para operações de heapify e troca.
+ * Equivale a heapsortPacientesModo(array, n, HEAPSORT_CLASSICO).
+ *
+ * @param array O array de Pacientes a ser ordenado.
+ * @param n O número de elementos no array.
+ */
+void heapsortPacientes(Paciente array[], HeapIndice n);
+
+/**
+ * @brief Ordena um array de Pacientes com a variante de Heapsort escolhida.
+ * A ordenação é feita in-place e em ordem ascendente de prioridade. Ambas as
+ * variantes movem os elementos por "buraco" (um movimento por nível, sem trocas).
+ *
+ * @param array O array de Pacientes a ser ordenado.
+ * @param n O número de elementos no array.
+ * @param modo HEAPSORT_CLASSICO ou HEAPSORT_BOTTOM_UP.
+ */
+void heapsortPacientesModo(Paciente array[], HeapIndice n, ModoHeapsort modo);
+
+/**
+ * @brief Ordena um array de Pacientes de forma estável, em ordem ascendente
+ * de prioridade: pacientes de mesma prioridade mantêm a ordem original.
+ * Cada paciente vira uma chave de 64 bits (prioridade nos bits altos, posição
+ * original nos baixos), as chaves são ordenadas com Heapsort bottom-up (uma
+ * comparação de inteiros por nível) e os pacientes são reposicionados pela
+ * posição guardada na chave. Usa buffers auxiliares de 16 bytes por elemento.
+ * Como a posição ocupa 32 bits, aceita até UINT32_MAX elementos.
+ *
+ * @param array O array de Pacientes a ser ordenado.
+ * @param n O número de elementos no array.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA (array inalterado) ou HEAP_ERRO_PARAMETRO.
+ */
+int heapsortPacientesEstavel(Paciente array[], HeapIndice n);
+
+// Abaixo deste número de elementos, ordenarPacientesParalelo usa o Heapsort sequencial
+#define ORDENACAO_PARALELA_MINIMO 65536
+
+/**
+ * @brief Ordena um array de Pacientes em paralelo, em ordem ascendente de prioridade.
+ * O array é dividido em 'threads' blocos; cada thread ordena seu bloco com
+ * Heapsort e os blocos são intercalados (k-way merge) usando uma MinHeap como
+ * fronteira. Entradas pequenas (menos de ORDENACAO_PARALELA_MINIMO elementos),
+ * threads <= 1 ou falta de memória para o buffer auxiliar recaem no Heapsort
+ * sequencial, assim como todas as chamadas em builds sem pthreads (sem
+ * HEAP_TEM_THREADS). Usa um buffer auxiliar de n elementos.
  *
  * @param array O array de Pacientes a ser ordenado.
  * @param n O número de elementos no array.
+ * @param threads Número de threads de ordenação.
+ */
+void ordenarPacientesParalelo(Paciente array[], HeapIndice n, int threads);
+
+/**
+ * @brief Ordena um array de Pacientes com radix sort LSD sobre a prioridade,
+ * em ordem ascendente e de forma estável. A chave é a prioridade com o bit de
+ * sinal invertido, menos a menor prioridade do array; só os bits que variam
+ * são ordenados, em 1 a 3 passadas de até 11 bits (ex.: prioridades de 0 a 999
+ * custam uma passada). Cada passada conta o histograma do dígito e espalha os
+ * pacientes entre o array e um buffer auxiliar (pingue-pongue); passadas em
+ * que todos os pacientes têm o mesmo dígito são puladas.
+ *
+ * @param array O array de Pacientes a ser ordenado.
+ * @param n O número de elementos no array.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA (buffer auxiliar de n elementos; array
+ * inalterado) ou HEAP_ERRO_PARAMETRO.
+ */
+int radixSortPacientes(Paciente array[], HeapIndice n);
+
+// Abaixo deste número de elementos, ordenarPacientes sempre usa o Heapsort
+#define ORDENACAO_RADIX_MINIMO 32
+
+/**
+ * @brief Ordena um array de Pacientes em ordem ascendente de prioridade,
+ * escolhendo o algoritmo pelo tamanho e pela faixa de prioridades: radix sort
+ * (radixSortPacientes) quando o array é grande em relação aos histogramas que
+ * a faixa de prioridades exige (ex.: a partir de ~128 pacientes com
+ * prioridades de 0 a 999 e ~768 com prioridades quaisquer), e o Heapsort
+ * in-place para arrays pequenos (menos de ORDENACAO_RADIX_MINIMO) ou quando o
+ * buffer auxiliar não pode ser alocado. A ordem entre prioridades iguais não
+ * é garantida (é estável só quando o radix sort é usado).
+ *
+ * @param array O array de Pacientes a ser ordenado.
+ * @param n O número de elementos no array.
+ */
+void ordenarPacientes(Paciente array[], HeapIndice n);
+
+/**
+ * @brief Copia as estatísticas acumuladas por todas as chamadas de Heapsort
+ * (clássico, bottom-up, estável e os blocos da ordenação paralela). Sem
+ * HEAP_INSTRUMENTACAO, 'saida' é zerada e saida->instrumentada fica 0.
+ *
+ * @param saida Recebe as estatísticas.
+ * @return HEAP_OK ou HEAP_ERRO_PARAMETRO.
+ */
+int obterEstatisticasHeapsort(EstatisticasHeap *saida);
+
+/**
+ * @brief Zera as estatísticas acumuladas do Heapsort.
  */
-void heapsortPacientes(Paciente array[], int n);
+void zerarEstatisticasHeapsort(void);
 
-#endif // HEAPSORT_H
\ No newline at end of file
+#endif // HEAPSORT_H
@@ -0,0 +1,115 @@
+#include "heapsort.h"
+#include "min_heap/min_heap.h" // Fronteira da intercalação
+#include <pthread.h>
+#include <stdlib.h> // malloc, calloc, free
+#include <string.h> // memcpy
+
+// Compilado só onde há pthreads (HEAP_TEM_THREADS); sem elas, heapsort.c
+// define ordenarPacientesParalelo como o Heapsort sequencial.
+
+// Bloco do array ordenado por uma thread em ordenarPacientesParalelo
+typedef struct {
+    Paciente *inicio;
+    HeapIndice tamanho;
+} BlocoOrdenacao;
+
+/**
+ * @brief Rotina de cada thread: ordena seu bloco com Heapsort bottom-up.
+ */
+static void* ordenarBloco(void *arg) {
+    BlocoOrdenacao *bloco = (BlocoOrdenacao*) arg;
+    heapsortPacientesModo(bloco->inicio, bloco->tamanho, HEAPSORT_BOTTOM_UP);
+    return NULL;
+}
+
+/**
+ * @brief Intercala 'k' blocos ordenados em 'destino' usando uma MinHeap como
+ * fronteira: cada entrada é {id = índice do bloco, prioridade = cabeça do bloco}.
+ * @return 1 em caso de sucesso, 0 se a MinHeap não pôde ser criada.
+ */
+static int intercalarBlocos(BlocoOrdenacao blocos[], int k, Paciente destino[]) {
+    MinHeap *fronteira = criarMinHeap(k);
+    if (fronteira == NULL) {
+        return 0;
+    }
+    HeapIndice *cursor = (HeapIndice*) calloc((size_t) k, sizeof(HeapIndice));
+    if (cursor == NULL) {
+        liberarMinHeap(fronteira);
+        return 0;
+    }
+    for (int b = 0; b < k; b++) {
+        if (blocos[b].tamanho > 0) {
+            inserirPacienteMin(fronteira, (Paciente){b, blocos[b].inicio[0].prioridade});
+        }
+    }
+
+    HeapIndice saida = 0;
+    while (!minHeapVazia(fronteira)) {
+        int b = extrairMinPacienteHeap(fronteira).id;
+        destino[saida++] = blocos[b].inicio[cursor[b]++];
+        if (cursor[b] < blocos[b].tamanho) {
+            inserirPacienteMin(fronteira, (Paciente){b, blocos[b].inicio[cursor[b]].prioridade});
+        }
+    }
+    free(cursor);
+    liberarMinHeap(fronteira);
+    return 1;
+}
+
+void ordenarPacientesParalelo(Paciente array[], HeapIndice n, int threads) {
+    if (array == NULL || n <= 1) {
+        return;
+    }
+    if (threads > n / 2) {
+        threads = n / 2;
+    }
+    if (threads <= 1 || n < ORDENACAO_PARALELA_MINIMO) {
+        heapsortPacientes(array, n);
+        return;
+    }
+
+    Paciente *auxiliar = (size_t) n <= SIZE_MAX / sizeof(Paciente)
+                       ? (Paciente*) malloc((size_t) n * sizeof(Paciente)) : NULL;
+    BlocoOrdenacao *blocos = (BlocoOrdenacao*) malloc((size_t) threads * sizeof(BlocoOrdenacao));
+    pthread_t *ids = (pthread_t*) malloc((size_t) threads * sizeof(pthread_t));
+    if (auxiliar == NULL || blocos == NULL || ids == NULL) {
+        free(auxiliar);
+        free(blocos);
+        free(ids);
+        heapsortPacientes(array, n);
+        return;
+    }
+
+    // Blocos contíguos de tamanho quase igual; a thread atual ordena o último
+    HeapIndice base = n / threads;
+    HeapIndice resto = n % threads;
+    HeapIndice inicio = 0;
+    for (int t = 0; t < threads; t++) {
+        blocos[t].inicio = array + inicio;
+        blocos[t].tamanho = base + (t < resto ? 1 : 0);
+        inicio += blocos[t].tamanho;
+    }
+    int criadas = 0;
+    for (int t = 0; t < threads - 1; t++) {
+        if (pthread_create(&ids[t], NULL, ordenarBloco, &blocos[t]) != 0) {
+            break;
+        }
+        criadas++;
+    }
+    // Blocos cujas threads não puderam ser criadas são ordenados aqui
+    for (int t = criadas; t < threads; t++) {
+        ordenarBloco(&blocos[t]);
+    }
+    for (int t = 0; t < criadas; t++) {
+        pthread_join(ids[t], NULL);
+    }
+
+    if (intercalarBlocos(blocos, threads, auxiliar)) {
+        memcpy(array, auxiliar, (size_t) n * sizeof(Paciente));
+    } else {
+        heapsortPacientes(array, n); // Blocos já ordenados; resultado continua correto
+    }
+    free(auxiliar);
+    free(blocos);
+    free(ids);
+}
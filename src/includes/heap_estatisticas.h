@@ -0,0 +1,172 @@
+#ifndef HEAP_ESTATISTICAS_H
+#define HEAP_ESTATISTICAS_H
+
+#include "includes/heap_status.h" // HEAP_ERRO_CHEIA
+
+// Instrumentação opcional das heaps (MaxHeap, MinHeap e Heapsort), ativada em
+// tempo de compilação com HEAP_INSTRUMENTACAO (opção do CMake). Sem ela, os
+// pontos de instrumentação viram nada e as estruturas não ganham campos.
+
+// Operações com histograma de latência próprio
+typedef enum {
+    HEAP_OP_INSERIR,
+    HEAP_OP_EXTRAIR,
+    HEAP_OP_LOTE,     // Inserção em lote e fusão
+    HEAP_OP_ORDENAR,  // Heapsort
+    HEAP_OP_QUANTIDADE
+} OperacaoHeap;
+
+// Faixa b do histograma: latência em [2^b, 2^(b+1)) ns (a última acumula o resto)
+#define HEAP_HISTOGRAMA_FAIXAS 32
+
+// Estatísticas acumuladas de uma heap (ou do Heapsort)
+typedef struct {
+    int instrumentada;                   // 0 se a biblioteca foi compilada sem HEAP_INSTRUMENTACAO
+    unsigned long long operacoes[HEAP_OP_QUANTIDADE];
+    unsigned long long comparacoes;
+    unsigned long long movimentos;       // Movimentos de elementos (um por nível com buraco)
+    unsigned long long niveis;           // Níveis percorridos por inserções e extrações
+    unsigned long long profundidadeMaxima; // Maior número de níveis em uma inserção ou extração
+    unsigned long long crescimentos;     // Realocações que aumentaram a capacidade
+    unsigned long long rejeicoesCheia;   // Inserções recusadas por capacidade fixa (HEAP_ERRO_CHEIA)
+    unsigned long long latencia[HEAP_OP_QUANTIDADE][HEAP_HISTOGRAMA_FAIXAS];
+} EstatisticasHeap;
+
+#ifdef HEAP_INSTRUMENTACAO
+
+#if defined(_MSC_VER)
+#define HEAP_LOCAL_THREAD __declspec(thread)
+#else
+#define HEAP_LOCAL_THREAD __thread
+#endif
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+// Contadores incrementados pelo motor genérico (via HEAP_MOVER e pela ordem
+// instrumentada). São locais à thread, e cada operação pública soma à sua
+// heap apenas a diferença entre o início e o fim.
+typedef struct {
+    unsigned long long comparacoes;
+    unsigned long long movimentos;
+} ContadoresHeap;
+
+// Estado capturado no início de uma operação instrumentada
+typedef struct {
+    unsigned long long inicioNs;
+    unsigned long long comparacoes;
+    unsigned long long movimentos;
+} MarcaInstrumentacao;
+
+/**
+ * @brief Retorna o instante atual em nanossegundos (relógio monotônico).
+ */
+static inline unsigned long long instrumentacaoAgoraNs(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER t;
+    if (freq.QuadPart == 0) {
+        QueryPerformanceFrequency(&freq);
+    }
+    QueryPerformanceCounter(&t);
+    return (unsigned long long) ((double) t.QuadPart * 1e9 / (double) freq.QuadPart);
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (unsigned long long) t.tv_sec * 1000000000ULL + (unsigned long long) t.tv_nsec;
+#endif
+}
+
+static inline void instrumentacaoIniciar(MarcaInstrumentacao *marca, const ContadoresHeap *contadores) {
+    marca->comparacoes = contadores->comparacoes;
+    marca->movimentos = contadores->movimentos;
+    marca->inicioNs = instrumentacaoAgoraNs();
+}
+
+/**
+ * @brief Soma às estatísticas os contadores e a latência da operação iniciada
+ * em 'marca'. Se 'heapify' for diferente de 0, a operação foi um único
+ * heapify (inserção ou extração) e seus movimentos menos o movimento final
+ * dão a profundidade percorrida.
+ */
+static inline void instrumentacaoRegistrar(EstatisticasHeap *e, const MarcaInstrumentacao *marca,
+                                           const ContadoresHeap *contadores, OperacaoHeap op, int heapify) {
+    unsigned long long ns = instrumentacaoAgoraNs() - marca->inicioNs;
+    unsigned long long movimentos = contadores->movimentos - marca->movimentos;
+    e->instrumentada = 1;
+    e->operacoes[op]++;
+    e->comparacoes += contadores->comparacoes - marca->comparacoes;
+    e->movimentos += movimentos;
+    if (heapify && movimentos > 0) {
+        e->niveis += movimentos - 1;
+        if (movimentos - 1 > e->profundidadeMaxima) {
+            e->profundidadeMaxima = movimentos - 1;
+        }
+    }
+    int faixa = 0;
+    while (ns > 1 && faixa < HEAP_HISTOGRAMA_FAIXAS - 1) {
+        ns >>= 1;
+        faixa++;
+    }
+    e->latencia[op][faixa]++;
+}
+
+/**
+ * @brief Soma as estatísticas de 'parcela' a 'total'.
+ */
+static inline void instrumentacaoSomar(EstatisticasHeap *total, const EstatisticasHeap *parcela) {
+    total->instrumentada |= parcela->instrumentada;
+    for (int op = 0; op < HEAP_OP_QUANTIDADE; op++) {
+        total->operacoes[op] += parcela->operacoes[op];
+        for (int f = 0; f < HEAP_HISTOGRAMA_FAIXAS; f++) {
+            total->latencia[op][f] += parcela->latencia[op][f];
+        }
+    }
+    total->comparacoes += parcela->comparacoes;
+    total->movimentos += parcela->movimentos;
+    total->niveis += parcela->niveis;
+    if (parcela->profundidadeMaxima > total->profundidadeMaxima) {
+        total->profundidadeMaxima = parcela->profundidadeMaxima;
+    }
+    total->crescimentos += parcela->crescimentos;
+    total->rejeicoesCheia += parcela->rejeicoesCheia;
+}
+
+/**
+ * @brief Registra uma operação pública de uma heap: contadores, latência,
+ * crescimento do array e rejeição por heap cheia.
+ */
+static inline void instrumentacaoRegistrarHeap(EstatisticasHeap *e, const MarcaInstrumentacao *marca,
+                                               const ContadoresHeap *contadores, long long capacidadeAnterior,
+                                               long long capacidadeAtual, OperacaoHeap op, int heapify, int status) {
+    instrumentacaoRegistrar(e, marca, contadores, op, heapify);
+    if (capacidadeAtual > capacidadeAnterior) {
+        e->crescimentos++;
+    }
+    if (status == HEAP_ERRO_CHEIA) {
+        e->rejeicoesCheia++;
+    }
+}
+
+// Pontos de instrumentação das funções públicas de uma heap com campo
+// 'estatisticas'; 'contadores' são os ContadoresHeap da instância do motor.
+#define HEAP_INSTRUMENTAR_INICIO(contadores, heap)                                     \
+    MarcaInstrumentacao marcaInstrumentacao;                                           \
+    long long capacidadeInstrumentacao = (heap)->capacidade;                           \
+    instrumentacaoIniciar(&marcaInstrumentacao, &(contadores))
+
+#define HEAP_INSTRUMENTAR_FIM(contadores, heap, op, heapify, status)                   \
+    instrumentacaoRegistrarHeap(&(heap)->estatisticas, &marcaInstrumentacao, &(contadores), \
+                                capacidadeInstrumentacao, (heap)->capacidade, (op), (heapify), (status))
+
+#else
+
+#define HEAP_INSTRUMENTAR_INICIO(contadores, heap) ((void) 0)
+#define HEAP_INSTRUMENTAR_FIM(contadores, heap, op, heapify, status) ((void) 0)
+
+#endif // HEAP_INSTRUMENTACAO
+
+#endif // HEAP_ESTATISTICAS_H
@@ -0,0 +1,26 @@
+#ifndef HEAP_INDICE_H
+#define HEAP_INDICE_H
+
+#include <limits.h> // INT_MAX
+#include <stddef.h> // ptrdiff_t
+#include <stdint.h> // PTRDIFF_MAX
+
+// Tipo dos tamanhos, capacidades e índices do motor genérico, da MaxHeap, da
+// MinHeap e do Heapsort. Por padrão é int (até ~10^9 pacientes por heap); com
+// HEAP_LARGA_ESCALA (opção do CMake) passa a ptrdiff_t, de 64 bits nas
+// plataformas suportadas. É com sinal de propósito: as funções que retornam
+// uma contagem também retornam códigos HeapStatus negativos, e os laços que
+// descem até o índice 0 continuam corretos.
+#ifdef HEAP_LARGA_ESCALA
+typedef ptrdiff_t HeapIndice;
+#define HEAP_INDICE_MAX PTRDIFF_MAX
+#else
+typedef int HeapIndice;
+#define HEAP_INDICE_MAX INT_MAX
+#endif
+
+// Maior número de elementos de uma heap: com índices até a metade do máximo,
+// o filho direito (2i + 2) do último nó nunca transborda.
+#define HEAP_TAMANHO_MAX (HEAP_INDICE_MAX / 2)
+
+#endif // HEAP_INDICE_H
@@ -0,0 +1,16 @@
+#ifndef HEAP_STATUS_H
+#define HEAP_STATUS_H
+
+// Códigos de retorno das operações que podem falhar nas heaps.
+// Substituem as mensagens impressas em stdout no caminho de inserção.
+typedef enum {
+    HEAP_OK = 0,              // Operação concluída com sucesso
+    HEAP_ERRO_PARAMETRO = -1, // Ponteiro nulo ou argumento inválido
+    HEAP_ERRO_CHEIA = -2,     // Heap de capacidade fixa sem espaço livre
+    HEAP_ERRO_MEMORIA = -3,   // Falha ao (re)alocar memória
+    HEAP_ERRO_DUPLICADO = -4, // Paciente com o mesmo id já está na heap
+    HEAP_ERRO_NAO_ENCONTRADO = -5, // Paciente com o id informado não está na heap
+    HEAP_ERRO_ARQUIVO = -6    // Falha ao abrir, ler ou gravar arquivo
+} HeapStatus;
+
+#endif // HEAP_STATUS_H
@@ -0,0 +1,17 @@
+#ifndef REGISTRO_PACIENTE_H
+#define REGISTRO_PACIENTE_H
+
+#include "paciente.h" // id e prioridade
+
+// Ficha completa de um paciente. As heaps em array guardam só o Paciente
+// (8 bytes); a ficha fica no slab de uma HeapIndireta (heap_indireta.h), que
+// ordena apenas pares (prioridade, referência) e nunca move a ficha.
+typedef struct {
+    Paciente paciente;   // id e prioridade (chave da fila)
+    char nome[48];       // Nome completo
+    char ala[16];        // Ala ou setor de destino
+    int sinaisVitais[4]; // Frequência cardíaca, pressão sistólica, SpO2 (%), temperatura (décimos de °C)
+    long long chegada;   // Instante de chegada (ns desde a abertura do turno)
+} RegistroPaciente;
+
+#endif // REGISTRO_PACIENTE_H
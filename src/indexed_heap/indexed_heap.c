@@ -0,0 +1,183 @@
+#include "indexed_heap.h"
+
+// Funções auxiliares estáticas
+
+/**
+ * @brief Retorna o índice do pai do nó i.
+ */
+static int paiIndexed(int i) {
+    return (i - 1) / 2;
+}
+
+/**
+ * @brief Retorna o índice do filho esquerdo do nó i.
+ */
+static int filhoEsquerdaIndexed(int i) {
+    return (2 * i) + 1;
+}
+
+/**
+ * @brief Retorna o índice do filho direito do nó i.
+ */
+static int filhoDireitaIndexed(int i) {
+    return (2 * i) + 2;
+}
+
+/**
+ * @brief Verifica se o id está no intervalo aceito pela heap.
+ */
+static int idValido(IndexedHeap *heap, int id) {
+    return id >= 0 && id <= heap->idMaximo;
+}
+
+/**
+ * @brief Move um paciente para a posição 'index' e atualiza o mapa id -> posição.
+ * @param heap Ponteiro para a IndexedHeap.
+ * @param index Posição de destino.
+ * @param p O Paciente movido.
+ */
+static void moverIndexado(IndexedHeap *heap, int index, Paciente p) {
+    heap->array[index] = p;
+    heap->posicao[p.id] = index;
+}
+
+/**
+ * @brief Sobe o paciente da posição 'index' mantendo o mapa atualizado.
+ * Usa um "buraco": um único movimento (e uma atualização do mapa) por nível.
+ */
+static void heapifyUpIndexed(IndexedHeap *heap, int index) {
+    Paciente p = heap->array[index];
+    while (index > 0 && heap->array[paiIndexed(index)].prioridade < p.prioridade) {
+        moverIndexado(heap, index, heap->array[paiIndexed(index)]);
+        index = paiIndexed(index);
+    }
+    moverIndexado(heap, index, p);
+}
+
+/**
+ * @brief Desce o paciente da posição 'index' mantendo o mapa atualizado.
+ */
+static void heapifyDownIndexed(IndexedHeap *heap, int index) {
+    Paciente p = heap->array[index];
+    int esq;
+    while ((esq = filhoEsquerdaIndexed(index)) < heap->tamanho) {
+        int maxIndex = esq;
+        int dir = filhoDireitaIndexed(index);
+        if (dir < heap->tamanho && heap->array[dir].prioridade > heap->array[esq].prioridade) {
+            maxIndex = dir;
+        }
+        if (heap->array[maxIndex].prioridade <= p.prioridade) {
+            break;
+        }
+        moverIndexado(heap, index, heap->array[maxIndex]);
+        index = maxIndex;
+    }
+    moverIndexado(heap, index, p);
+}
+
+/**
+ * @brief Remove o paciente da posição 'index', colocando o último em seu lugar.
+ * @return O Paciente removido.
+ */
+static Paciente removerNaPosicao(IndexedHeap *heap, int index) {
+    Paciente removido = heap->array[index];
+    heap->posicao[removido.id] = -1;
+    heap->tamanho--;
+    if (index != heap->tamanho) {
+        heap->array[index] = heap->array[heap->tamanho];
+        heap->posicao[heap->array[index].id] = index;
+        // O substituto pode precisar subir (veio de outra subárvore) ou descer
+        if (index > 0 && heap->array[paiIndexed(index)].prioridade < heap->array[index].prioridade) {
+            heapifyUpIndexed(heap, index);
+        } else {
+            heapifyDownIndexed(heap, index);
+        }
+    }
+    return removido;
+}
+
+// Implementações das funções públicas
+
+IndexedHeap* criarIndexedHeap(int idMaximo) {
+    if (idMaximo < 0) return NULL;
+    IndexedHeap *heap = (IndexedHeap*) malloc(sizeof(IndexedHeap));
+    if (heap == NULL) {
+        perror("Falha ao alocar memória para heap (IndexedHeap)");
+        return NULL;
+    }
+    size_t capacidade = (size_t) idMaximo + 1;
+    heap->array = (Paciente*) malloc(capacidade * sizeof(Paciente));
+    heap->posicao = (int*) malloc(capacidade * sizeof(int));
+    if (heap->array == NULL || heap->posicao == NULL) {
+        perror("Falha ao alocar memória para os arrays da heap (IndexedHeap)");
+        free(heap->array);
+        free(heap->posicao);
+        free(heap);
+        return NULL;
+    }
+    for (size_t i = 0; i < capacidade; i++) {
+        heap->posicao[i] = -1;
+    }
+    heap->tamanho = 0;
+    heap->idMaximo = idMaximo;
+    return heap;
+}
+
+int inserirPacienteIndexed(IndexedHeap *heap, Paciente p) {
+    if (heap == NULL || !idValido(heap, p.id)) return HEAP_ERRO_PARAMETRO;
+    if (heap->posicao[p.id] != -1) return HEAP_ERRO_DUPLICADO;
+    heap->array[heap->tamanho] = p;
+    heap->posicao[p.id] = heap->tamanho;
+    heap->tamanho++;
+    heapifyUpIndexed(heap, heap->tamanho - 1);
+    return HEAP_OK;
+}
+
+Paciente extrairMaxPacienteIndexed(IndexedHeap *heap) {
+    Paciente pVazio = {-1, -1};
+    if (heap == NULL || heap->tamanho <= 0) {
+        return pVazio;
+    }
+    return removerNaPosicao(heap, 0);
+}
+
+int atualizarPrioridade(IndexedHeap *heap, int id, int novaPrioridade) {
+    if (heap == NULL || !idValido(heap, id)) return HEAP_ERRO_PARAMETRO;
+    int index = heap->posicao[id];
+    if (index == -1) return HEAP_ERRO_NAO_ENCONTRADO;
+
+    int antiga = heap->array[index].prioridade;
+    heap->array[index].prioridade = novaPrioridade;
+    if (novaPrioridade > antiga) {
+        heapifyUpIndexed(heap, index);
+    } else if (novaPrioridade < antiga) {
+        heapifyDownIndexed(heap, index);
+    }
+    return HEAP_OK;
+}
+
+int removerPaciente(IndexedHeap *heap, int id) {
+    if (heap == NULL || !idValido(heap, id)) return HEAP_ERRO_PARAMETRO;
+    int index = heap->posicao[id];
+    if (index == -1) return HEAP_ERRO_NAO_ENCONTRADO;
+    removerNaPosicao(heap, index);
+    return HEAP_OK;
+}
+
+int contemPaciente(IndexedHeap *heap, int id) {
+    if (heap == NULL || !idValido(heap, id)) return 0;
+    return heap->posicao[id] != -1;
+}
+
+int indexedHeapVazia(IndexedHeap *heap) {
+    if (heap == NULL) return 1;
+    return heap->tamanho == 0;
+}
+
+void liberarIndexedHeap(IndexedHeap *heap) {
+    if (heap != NULL) {
+        free(heap->array);
+        free(heap->posicao);
+        free(heap);
+    }
+}
@@ -0,0 +1,80 @@
+#ifndef INDEXED_HEAP_H
+#define INDEXED_HEAP_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Estrutura para a Max-Heap indexada: além do array da heap, mantém um mapa
+// id -> posição no array, permitindo localizar qualquer paciente em O(1).
+typedef struct {
+    Paciente *array; // Ponteiro para o array de pacientes
+    int *posicao;    // posicao[id] = índice do paciente no array, ou -1 se ausente
+    int tamanho;     // Número atual de pacientes na heap
+    int idMaximo;    // Maior id aceito (ids válidos: 0..idMaximo)
+} IndexedHeap;
+
+/**
+ * @brief Cria uma nova Max-Heap indexada.
+ * Como cada id aparece no máximo uma vez, a capacidade é idMaximo + 1.
+ * @param idMaximo O maior id de paciente aceito.
+ * @return Ponteiro para a IndexedHeap criada, ou NULL em caso de falha.
+ */
+IndexedHeap* criarIndexedHeap(int idMaximo);
+
+/**
+ * @brief Insere um paciente na Max-Heap indexada.
+ * @param heap Ponteiro para a IndexedHeap.
+ * @param p O Paciente a ser inserido (id entre 0 e idMaximo).
+ * @return HEAP_OK, HEAP_ERRO_DUPLICADO ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacienteIndexed(IndexedHeap *heap, Paciente p);
+
+/**
+ * @brief Extrai e retorna o paciente com a maior prioridade.
+ * @param heap Ponteiro para a IndexedHeap.
+ * @return O Paciente com a maior prioridade. Se a heap estiver vazia,
+ * retorna um Paciente com id e prioridade -1.
+ */
+Paciente extrairMaxPacienteIndexed(IndexedHeap *heap);
+
+/**
+ * @brief Altera a prioridade de um paciente já presente na heap em O(log n).
+ * @param heap Ponteiro para a IndexedHeap.
+ * @param id O id do paciente.
+ * @param novaPrioridade A nova prioridade.
+ * @return HEAP_OK, HEAP_ERRO_NAO_ENCONTRADO ou HEAP_ERRO_PARAMETRO.
+ */
+int atualizarPrioridade(IndexedHeap *heap, int id, int novaPrioridade);
+
+/**
+ * @brief Remove da heap o paciente com o id informado em O(log n).
+ * @param heap Ponteiro para a IndexedHeap.
+ * @param id O id do paciente.
+ * @return HEAP_OK, HEAP_ERRO_NAO_ENCONTRADO ou HEAP_ERRO_PARAMETRO.
+ */
+int removerPaciente(IndexedHeap *heap, int id);
+
+/**
+ * @brief Verifica em O(1) se o paciente com o id informado está na heap.
+ * @param heap Ponteiro para a IndexedHeap.
+ * @param id O id do paciente.
+ * @return 1 se o paciente estiver na heap, 0 caso contrário.
+ */
+int contemPaciente(IndexedHeap *heap, int id);
+
+/**
+ * @brief Verifica se a Max-Heap indexada está vazia.
+ * @param heap Ponteiro para a IndexedHeap.
+ * @return 1 se a heap estiver vazia, 0 caso contrário.
+ */
+int indexedHeapVazia(IndexedHeap *heap);
+
+/**
+ * @brief Libera a memória alocada para a Max-Heap indexada.
+ * @param heap Ponteiro para a IndexedHeap a ser liberada.
+ */
+void liberarIndexedHeap(IndexedHeap *heap);
+
+#endif // INDEXED_HEAP_H
@@ -4,6 +4,28 @@
 #include "max_heap/max_heap.h" 
 #include "min_heap/min_heap.h" 
 #include "heapsort/heapsort.h" 
+#include "dary_heap/dary_heap.h"
+#include "indexed_heap/indexed_heap.h"
+#include "heap_chegada/heap_chegada.h"
+#include "heap_estavel/heap_estavel.h"
+#ifdef HEAP_TEM_FILA_CONCORRENTE
+#include "fila_concorrente/fila_concorrente.h"
+#endif
+#include "fila_baldes/fila_baldes.h"
+#include "heap_min_max/heap_min_max.h"
+#include "fila_envelhecimento/fila_envelhecimento.h"
+#include "top_k/top_k.h"
+#ifdef HEAP_TEM_PERSISTENCIA
+#include "heap_persistente/heap_persistente.h"
+#endif
+#include "pairing_heap/pairing_heap.h"
+#include "heap_indireta/heap_indireta.h"
+#include "includes/registro_paciente.h"
+#include "ordenacao_externa/ordenacao_externa.h"
+#include "trace/trace.h"
+#include "replay/replay.h"
+#include <string.h> // strcmp
+#include <stddef.h> // offsetof
 
 /**
  * @brief Imprime os elementos de um array de Pacientes.
@@ -44,7 +66,11 @@ void testarMaxHeap() {
 
     // Teste de inserção em heap cheia
     printf("\nTentando inserir em Max-Heap cheia:\n");
-    inserirPacienteMax(heap, (Paciente){99, 100}); // Deve falhar ou avisar
+    if (inserirPacienteMax(heap, (Paciente){99, 100}) == HEAP_ERRO_CHEIA) {
+        printf("  Corretamente rejeitou paciente ID 99 (heap cheia).\n");
+    } else {
+        printf("  ERRO: Deveria ter rejeitado a inserção em heap cheia.\n");
+    }
 
 
     printf("\nExtraindo pacientes da Max-Heap (devem sair em ordem de maior prioridade):\n");
@@ -99,7 +125,11 @@ void testarMinHeap() {
 
     // Teste de inserção em heap cheia
     printf("\nTentando inserir em Min-Heap cheia:\n");
-    inserirPacienteMin(heap, (Paciente){98, 5}); // Deve falhar ou avisar
+    if (inserirPacienteMin(heap, (Paciente){98, 5}) == HEAP_ERRO_CHEIA) {
+        printf("  Corretamente rejeitou paciente ID 98 (heap cheia).\n");
+    } else {
+        printf("  ERRO: Deveria ter rejeitado a inserção em heap cheia.\n");
+    }
 
     printf("\nExtraindo pacientes da Min-Heap (devem sair em ordem de menor prioridade):\n");
     while (!minHeapVazia(heap)) {
@@ -131,6 +161,545 @@ void testarMinHeap() {
     printf("-------------------------\n\n");
 }
 
+/**
+ * @brief Testa o crescimento automático e as chamadas reservar/encolher.
+ */
+void testarHeapExpansivel() {
+    printf("--- Testando Heap Expansível ---\n");
+    MaxHeap *heap = criarMaxHeapExpansivel(2);
+
+    if (!heap) {
+        printf("Falha ao criar Max-Heap expansível. Teste abortado.\n");
+        return;
+    }
+
+    printf("Inserindo 10 pacientes em Max-Heap com capacidade inicial 2...\n");
+    for (int i = 0; i < 10; i++) {
+        if (inserirPacienteMax(heap, (Paciente){50 + i, (i * 37) % 100}) != HEAP_OK) {
+            printf("  ERRO: Inserção do paciente ID %d falhou.\n", 50 + i);
+        }
+    }
+    printf("  Tamanho: %lld, Capacidade após crescimento: %lld\n", (long long) heap->tamanho,
+           (long long) heap->capacidade);
+
+    reservarMaxHeap(heap, 100);
+    printf("  Capacidade após reservarMaxHeap(100): %lld\n", (long long) heap->capacidade);
+
+    encolherMaxHeap(heap);
+    printf("  Capacidade após encolherMaxHeap: %lld\n", (long long) heap->capacidade);
+
+    printf("Extraindo pacientes da Max-Heap expansível:\n");
+    while (!maxHeapVazia(heap)) {
+        Paciente p = extrairMaxPacienteHeap(heap);
+        printf("  Extraído -> ID: %2d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+
+    liberarMaxHeap(heap);
+    printf("Max-Heap expansível liberada.\n");
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a construção em O(n) a partir de array e a inserção em lote.
+ */
+void testarConstrucaoEmLote() {
+    printf("--- Testando Construção a partir de Array e Inserção em Lote ---\n");
+    Paciente iniciais[] = {{61, 30}, {62, 80}, {63, 10}, {64, 55}};
+    Paciente lote[] = {{65, 95}, {66, 5}, {67, 70}};
+    int nIniciais = sizeof(iniciais) / sizeof(iniciais[0]);
+    int nLote = sizeof(lote) / sizeof(lote[0]);
+
+    MinHeap *heap = criarMinHeapDeArray(iniciais, nIniciais, 0); // Copia o array
+
+    if (!heap) {
+        printf("Falha ao criar Min-Heap a partir de array. Teste abortado.\n");
+        return;
+    }
+
+    if (inserirLoteMin(heap, lote, nLote) != HEAP_OK) {
+        printf("  ERRO: Inserção em lote falhou.\n");
+    }
+
+    printf("Extraindo pacientes (devem sair em ordem de menor prioridade):\n");
+    while (!minHeapVazia(heap)) {
+        Paciente p = extrairMinPacienteHeap(heap);
+        printf("  Extraído -> ID: %2d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+
+    liberarMinHeap(heap);
+    printf("Min-Heap liberada.\n");
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa as funcionalidades da Max-Heap d-ária.
+ */
+void testarDaryHeap() {
+    printf("--- Testando Max-Heap %d-ária ---\n", DARY_ARIDADE);
+    DaryHeap *heap = criarDaryHeapExpansivel(4);
+
+    if (!heap) {
+        printf("Falha ao criar Max-Heap d-ária. Teste abortado.\n");
+        return;
+    }
+
+    printf("Inserindo 12 pacientes na Max-Heap d-ária...\n");
+    for (int i = 0; i < 12; i++) {
+        inserirPacienteDary(heap, (Paciente){70 + i, (i * 53) % 100});
+    }
+
+    printf("Extraindo pacientes (devem sair em ordem de maior prioridade):\n");
+    while (!daryHeapVazia(heap)) {
+        Paciente p = extrairMaxPacienteDary(heap);
+        printf("  Extraído -> ID: %2d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+
+    liberarDaryHeap(heap);
+    printf("Max-Heap d-ária liberada.\n");
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a Max-Heap indexada: reclassificação e remoção por id.
+ */
+void testarIndexedHeap() {
+    printf("--- Testando Max-Heap Indexada ---\n");
+    IndexedHeap *heap = criarIndexedHeap(100);
+
+    if (!heap) {
+        printf("Falha ao criar Max-Heap indexada. Teste abortado.\n");
+        return;
+    }
+
+    inserirPacienteIndexed(heap, (Paciente){81, 40});
+    inserirPacienteIndexed(heap, (Paciente){82, 75});
+    inserirPacienteIndexed(heap, (Paciente){83, 60});
+    inserirPacienteIndexed(heap, (Paciente){84, 20});
+    if (inserirPacienteIndexed(heap, (Paciente){82, 10}) == HEAP_ERRO_DUPLICADO) {
+        printf("  Corretamente rejeitou ID 82 duplicado.\n");
+    }
+
+    printf("Reclassificando ID 84 para prioridade 90 e removendo ID 83...\n");
+    atualizarPrioridade(heap, 84, 90);
+    removerPaciente(heap, 83);
+    printf("  contemPaciente(83) = %d, contemPaciente(84) = %d\n",
+           contemPaciente(heap, 83), contemPaciente(heap, 84));
+
+    printf("Extraindo pacientes (devem sair em ordem de maior prioridade):\n");
+    while (!indexedHeapVazia(heap)) {
+        Paciente p = extrairMaxPacienteIndexed(heap);
+        printf("  Extraído -> ID: %2d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+
+    liberarIndexedHeap(heap);
+    printf("Max-Heap indexada liberada.\n");
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a Max-Heap com desempate por ordem de chegada (motor genérico).
+ */
+void testarHeapChegada() {
+    printf("--- Testando Max-Heap com Desempate por Chegada ---\n");
+    MaxHeapChegada *heap = criarMaxHeapChegada(4);
+
+    if (!heap) {
+        printf("Falha ao criar Max-Heap com desempate por chegada. Teste abortado.\n");
+        return;
+    }
+
+    inserirPacienteMaxChegada(heap, (Paciente){91, 50});
+    inserirPacienteMaxChegada(heap, (Paciente){92, 80});
+    inserirPacienteMaxChegada(heap, (Paciente){93, 50});
+    inserirPacienteMaxChegada(heap, (Paciente){94, 80});
+    inserirPacienteMaxChegada(heap, (Paciente){95, 50});
+
+    printf("Extraindo pacientes (prioridades iguais saem por ordem de ID):\n");
+    while (!maxHeapChegadaVazia(heap)) {
+        Paciente p = extrairMaxPacienteChegada(heap);
+        printf("  Extraído -> ID: %2d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+
+    liberarMaxHeapChegada(heap);
+    printf("Max-Heap com desempate por chegada liberada.\n");
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa as heaps e o Heapsort estáveis (FIFO entre prioridades iguais).
+ */
+void testarHeapEstavel() {
+    printf("--- Testando Heaps Estáveis (FIFO) ---\n");
+    MaxHeapEstavel *maxHeap = criarMaxHeapEstavel(4);
+    MinHeapEstavel *minHeap = criarMinHeapEstavel(4);
+
+    if (!maxHeap || !minHeap) {
+        printf("Falha ao criar heaps estáveis. Teste abortado.\n");
+        liberarMaxHeapEstavel(maxHeap);
+        liberarMinHeapEstavel(minHeap);
+        return;
+    }
+
+    // Ids fora de ordem: a ordem de saída depende só da ordem de inserção
+    Paciente chegada[] = {{105, 50}, {101, 80}, {104, 50}, {102, 80}, {103, 50}};
+    int n = sizeof(chegada) / sizeof(chegada[0]);
+    for (int i = 0; i < n; i++) {
+        inserirPacienteMaxEstavel(maxHeap, chegada[i]);
+        inserirPacienteMinEstavel(minHeap, chegada[i]);
+    }
+
+    printf("Max-Heap estável (prioridades iguais saem na ordem de inserção):\n");
+    while (!maxHeapEstavelVazia(maxHeap)) {
+        Paciente p = extrairMaxPacienteEstavel(maxHeap);
+        printf("  Extraído -> ID: %3d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+    printf("Min-Heap estável:\n");
+    while (!minHeapEstavelVazia(minHeap)) {
+        Paciente p = extrairMinPacienteEstavel(minHeap);
+        printf("  Extraído -> ID: %3d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+    liberarMaxHeapEstavel(maxHeap);
+    liberarMinHeapEstavel(minHeap);
+
+    heapsortPacientesEstavel(chegada, n);
+    imprimirPacientesArray("Heapsort estável (prioridade ascendente, empates na ordem original):", chegada, n);
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a fila de prioridade por baldes (faixa de prioridades fixa).
+ */
+void testarFilaBaldes() {
+    printf("--- Testando Fila por Baldes ---\n");
+    FilaBaldes *fila = criarFilaBaldes(1, 5); // Escala de triagem de 1 a 5
+
+    if (!fila) {
+        printf("Falha ao criar fila por baldes. Teste abortado.\n");
+        return;
+    }
+
+    Paciente pacientes[] = {{111, 3}, {112, 5}, {113, 1}, {114, 3}, {115, 5}, {116, 2}};
+    int n = sizeof(pacientes) / sizeof(pacientes[0]);
+    for (int i = 0; i < n; i++) {
+        inserirPacienteBaldes(fila, pacientes[i]);
+    }
+    if (inserirPacienteBaldes(fila, (Paciente){117, 9}) == HEAP_ERRO_PARAMETRO) {
+        printf("Paciente 117 rejeitado: prioridade 9 fora da faixa [1, 5].\n");
+    }
+
+    Paciente menor = extrairMinPacienteBaldes(fila);
+    printf("Menor prioridade -> ID: %3d, Prioridade: %3d\n", menor.id, menor.prioridade);
+    printf("Extraindo os demais por maior prioridade (empates em ordem de chegada):\n");
+    while (!filaBaldesVazia(fila)) {
+        Paciente p = extrairMaxPacienteBaldes(fila);
+        printf("  Extraído -> ID: %3d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+
+    liberarFilaBaldes(fila);
+    printf("Fila por baldes liberada.\n");
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a heap min-max: o mais urgente vai para o próximo médico livre
+ * e o menos urgente é encaminhado a outra clínica, na mesma fila.
+ */
+void testarHeapMinMax() {
+    printf("--- Testando Heap Min-Max ---\n");
+    HeapMinMax *heap = criarHeapMinMaxExpansivel(4);
+
+    if (!heap) {
+        printf("Falha ao criar heap min-max. Teste abortado.\n");
+        return;
+    }
+
+    Paciente pacientes[] = {{171, 45}, {172, 90}, {173, 10}, {174, 70}, {175, 25}, {176, 60}, {177, 5}};
+    int n = sizeof(pacientes) / sizeof(pacientes[0]);
+    for (int i = 0; i < n; i++) {
+        inserirPacienteMinMax(heap, pacientes[i]);
+    }
+    Paciente maior = espiarMaxPacienteMinMax(heap);
+    Paciente menor = espiarMinPacienteMinMax(heap);
+    printf("Espiando -> maior: ID %3d (%3d), menor: ID %3d (%3d)\n", maior.id, maior.prioridade, menor.id,
+           menor.prioridade);
+    while (!heapMinMaxVazia(heap)) {
+        Paciente urgente = extrairMaxPacienteMinMax(heap);
+        printf("  Médico livre   -> ID: %3d, Prioridade: %3d\n", urgente.id, urgente.prioridade);
+        if (!heapMinMaxVazia(heap)) {
+            Paciente encaminhado = extrairMinPacienteMinMax(heap);
+            printf("  Outra clínica  -> ID: %3d, Prioridade: %3d\n", encaminhado.id, encaminhado.prioridade);
+        }
+    }
+
+    liberarHeapMinMax(heap);
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa o envelhecimento de prioridades: quem espera ganha 2 pontos
+ * por tique, até o teto de 20 pontos, sem reconstruir a fila.
+ */
+void testarFilaEnvelhecimento() {
+    printf("--- Testando Fila com Envelhecimento ---\n");
+    SegmentoEnvelhecimento curva[] = {{0, 2}, {10, 0}};
+    FilaEnvelhecimento *fila = criarFilaEnvelhecimento(curva, 2);
+
+    if (!fila) {
+        printf("Falha ao criar fila com envelhecimento. Teste abortado.\n");
+        return;
+    }
+
+    inserirPacienteEnvelhecimento(fila, (Paciente){181, 10}); // Chega em t = 0
+    inserirPacienteEnvelhecimento(fila, (Paciente){182, 5});
+    avancarRelogioEnvelhecimento(fila, 8);
+    inserirPacienteEnvelhecimento(fila, (Paciente){183, 25}); // Chega em t = 8
+    inserirPacienteEnvelhecimento(fila, (Paciente){184, 18});
+    avancarRelogioEnvelhecimento(fila, 12);
+
+    printf("Atendimentos em t = 12 (prioridade base -> efetiva):\n");
+    while (!filaEnvelhecimentoVazia(fila)) {
+        long long efetiva;
+        Paciente p = extrairMaxPacienteEnvelhecimento(fila, &efetiva);
+        printf("  Extraído -> ID: %3d, Prioridade: %3d -> %3lld\n", p.id, p.prioridade, efetiva);
+    }
+
+    liberarFilaEnvelhecimento(fila);
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a criação de heaps sem alocação por heap: memória do chamador
+ * (na pilha) e uma arena com uma fila por departamento, liberadas de uma vez.
+ */
+void testarAlocacaoHeaps() {
+    printf("--- Testando Heaps em Memória do Chamador e Arena ---\n");
+    Paciente armazenamento[4];
+    MaxHeap triagem;
+    inicializarMaxHeap(&triagem, armazenamento, 4, 1);
+    for (int i = 0; i < 6; i++) {
+        inserirPacienteMax(&triagem, (Paciente){191 + i, (i * 29) % 100});
+    }
+    printf("Heap na pilha: %lld pacientes, capacidade %lld (%s)\n", (long long) triagem.tamanho,
+           (long long) triagem.capacidade,
+           triagem.arrayEmprestado ? "array da pilha" : "cresceu para um array próprio");
+    Paciente p = extrairMaxPacienteHeap(&triagem);
+    printf("  Extraído -> ID: %2d, Prioridade: %3d\n", p.id, p.prioridade);
+    finalizarMaxHeap(&triagem);
+
+    const char *departamentos[] = {"Cardiologia", "Ortopedia", "Pediatria"};
+    ArenaHeaps *arena = criarArenaHeaps(0);
+    if (!arena) {
+        printf("Falha ao criar a arena. Teste abortado.\n");
+        return;
+    }
+    MaxHeap *filas[3];
+    for (int d = 0; d < 3; d++) {
+        filas[d] = criarMaxHeapNaArena(arena, 4, 1);
+        if (!filas[d]) {
+            printf("Falha ao criar a fila de %s. Teste abortado.\n", departamentos[d]);
+            liberarArenaHeaps(arena);
+            return;
+        }
+        for (int i = 0; i < 3; i++) {
+            inserirPacienteMax(filas[d], (Paciente){200 + 10 * d + i, (d * 31 + i * 17) % 100});
+        }
+    }
+    for (int d = 0; d < 3; d++) {
+        p = extrairMaxPacienteHeap(filas[d]);
+        printf("  %-12s -> ID: %3d, Prioridade: %3d\n", departamentos[d], p.id, p.prioridade);
+    }
+    printf("Arena com %zu bytes recortados; liberando todas as filas de uma vez.\n", arena->bytesRecortados);
+    liberarArenaHeaps(arena);
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a extração em lote dos pacientes mais urgentes (troca de turno).
+ */
+void testarExtracaoEmLote() {
+    printf("--- Testando Extração em Lote ---\n");
+    MaxHeap *heap = criarMaxHeapExpansivel(0);
+    MinHeap *menores = criarMinHeapExpansivel(0);
+    if (!heap || !menores) {
+        printf("Falha ao criar as heaps. Teste abortado.\n");
+        liberarMaxHeap(heap);
+        liberarMinHeap(menores);
+        return;
+    }
+    for (int i = 0; i < 12; i++) {
+        Paciente p = {231 + i, (i * 53 + 11) % 100};
+        inserirPacienteMax(heap, p);
+        inserirPacienteMin(menores, p);
+    }
+    Paciente lote[5];
+    int extraidos = (int) extrairLoteMax(heap, 5, lote);
+    printf("Troca de turno: %d mais urgentes de uma vez (restam %lld):\n", extraidos, (long long) heap->tamanho);
+    for (int i = 0; i < extraidos; i++) {
+        printf("  Extraído -> ID: %3d, Prioridade: %3d\n", lote[i].id, lote[i].prioridade);
+    }
+    printf("Próximo da fila -> ID: %3d\n", extrairMaxPacienteHeap(heap).id);
+    extraidos = (int) extrairLoteMin(menores, 3, lote);
+    printf("extrairLoteMin (k = 3):");
+    for (int i = 0; i < extraidos; i++) {
+        printf(" %d", lote[i].prioridade);
+    }
+    printf("\n");
+    liberarMaxHeap(heap);
+    liberarMinHeap(menores);
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a inserção adiada: uma rajada de chegadas fica pendente até a
+ * próxima extração, e espiar enxerga o mais urgente mesmo assim.
+ */
+void testarInsercaoAdiada() {
+    printf("--- Testando Inserção Adiada ---\n");
+    MaxHeap *heap = criarMaxHeapExpansivel(0);
+    MinHeap *menores = criarMinHeapExpansivel(0);
+    if (!heap || !menores) {
+        printf("Falha ao criar as heaps. Teste abortado.\n");
+        liberarMaxHeap(heap);
+        liberarMinHeap(menores);
+        return;
+    }
+    for (int i = 0; i < 6; i++) {
+        Paciente p = {301 + i, (i * 37 + 20) % 90};
+        inserirPacienteMax(heap, p);
+        inserirPacienteMin(menores, p);
+    }
+    definirInsercaoAdiadaMaxHeap(heap, 1);
+    definirInsercaoAdiadaMinHeap(menores, 1);
+    for (int i = 0; i < 8; i++) { // Rajada de ambulâncias
+        Paciente p = {401 + i, (i * 41 + 7) % 100};
+        inserirPacienteMax(heap, p);
+        inserirPacienteMin(menores, p);
+    }
+    Paciente topo = espiarMaxPacienteHeap(heap);
+    printf("Após a rajada: %lld pacientes, %lld pendentes; espiar -> ID: %d, Prioridade: %d\n",
+           (long long) heap->tamanho, (long long) heap->pendentes, topo.id, topo.prioridade);
+    printf("Ordem de atendimento:");
+    while (!maxHeapVazia(heap)) {
+        printf(" %d", extrairMaxPacienteHeap(heap).prioridade);
+    }
+    printf("\n");
+    printf("espiarMinPacienteHeap -> Prioridade: %d; extrairMinPacienteHeap:",
+           espiarMinPacienteHeap(menores).prioridade);
+    for (int i = 0; i < 4; i++) {
+        printf(" %d", extrairMinPacienteHeap(menores).prioridade);
+    }
+    printf("\n");
+    liberarMaxHeap(heap);
+    liberarMinHeap(menores);
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a Max-Heap com o array em páginas grandes.
+ */
+void testarPaginasGrandes() {
+    printf("--- Testando Páginas Grandes ---\n");
+    printf("HeapIndice de %d bits (HEAP_TAMANHO_MAX = %lld)\n", (int) (sizeof(HeapIndice) * 8),
+           (long long) HEAP_TAMANHO_MAX);
+    MaxHeap *heap = criarMaxHeapExpansivel(0);
+    if (heap == NULL || definirPaginasMaxHeap(heap, PAGINAS_TRANSPARENTES) != HEAP_OK) {
+        printf("Falha ao criar a heap. Teste abortado.\n");
+        liberarMaxHeap(heap);
+        return;
+    }
+    for (int i = 0; i < 300000; i++) {
+        inserirPacienteMax(heap, (Paciente){i, (int) ((i * 7919L) % 100003)});
+    }
+    printf("%lld pacientes em páginas %s, capacidade %lld\n", (long long) heap->tamanho,
+           nomeModoPaginas(heap->paginas), (long long) heap->capacidade);
+    printf("Mais urgente -> ID: %d\n", extrairMaxPacienteHeap(heap).id);
+    liberarMaxHeap(heap);
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa o radix sort e a escolha automática de ordenarPacientes.
+ */
+void testarOrdenacaoRadix() {
+    printf("--- Testando Radix Sort ---\n");
+    Paciente pacientes[] = {
+        {51, 30}, {52, -5}, {53, 30}, {54, 1200}, {55, 0},
+        {56, -5}, {57, 7}, {58, 30}, {59, -300}, {60, 7}
+    };
+    int n = sizeof(pacientes) / sizeof(pacientes[0]);
+    imprimirPacientesArray("Array ANTES do radix sort (com prioridades negativas):", pacientes, n);
+    radixSortPacientes(pacientes, n);
+    imprimirPacientesArray("Array DEPOIS (ascendente; empates na ordem original):", pacientes, n);
+
+    const int total = 5000;
+    Paciente *triagem = (Paciente*) malloc((size_t) total * sizeof(Paciente));
+    if (triagem == NULL) {
+        printf("Falha ao alocar o array. Teste abortado.\n");
+        return;
+    }
+    for (int i = 0; i < total; i++) {
+        triagem[i] = (Paciente){i, (i * 7919) % 1000};
+    }
+    ordenarPacientes(triagem, total);
+    int ordenado = 1;
+    for (int i = 1; i < total; i++) {
+        if (triagem[i - 1].prioridade > triagem[i].prioridade) ordenado = 0;
+    }
+    printf("ordenarPacientes com %d pacientes: %s (menor %d, maior %d)\n", total,
+           ordenado ? "ordenado" : "FORA DE ORDEM", triagem[0].prioridade, triagem[total - 1].prioridade);
+    free(triagem);
+    printf("-------------------------\n\n");
+}
+
+#ifdef HEAP_TEM_FILA_CONCORRENTE
+/**
+ * @brief Thread de recepção: insere 5 pacientes na fila concorrente.
+ */
+static void* recepcaoConcorrente(void *arg) {
+    FilaConcorrente *fila = (FilaConcorrente*) arg;
+    for (int i = 0; i < 5; i++) {
+        inserirPacienteConcorrente(fila, (Paciente){100 + i, (i * 29) % 100});
+    }
+    return NULL;
+}
+
+/**
+ * @brief Testa a fila de prioridade concorrente com duas threads de recepção.
+ */
+void testarFilaConcorrente() {
+    printf("--- Testando Fila Concorrente (MultiQueue) ---\n");
+    FilaConcorrente *fila = criarFilaConcorrente(4, 8);
+
+    if (!fila) {
+        printf("Falha ao criar fila concorrente. Teste abortado.\n");
+        return;
+    }
+
+    pthread_t recepcoes[2];
+    for (int i = 0; i < 2; i++) {
+        pthread_create(&recepcoes[i], NULL, recepcaoConcorrente, fila);
+    }
+    for (int i = 0; i < 2; i++) {
+        pthread_join(recepcoes[i], NULL);
+    }
+
+    Paciente lote[3];
+    int n = extrairLoteConcorrente(fila, lote, 3);
+    printf("Lote de %d pacientes extraído (relaxado: urgentes, não necessariamente os 3 maiores).\n", n);
+    fecharFilaConcorrente(fila);
+
+    int restantes = 0;
+    while (extrairMaxConcorrente(fila).id != -1) {
+        restantes++;
+    }
+    printf("  Restantes extraídos com extrairMaxConcorrente: %d (esperado %d)\n", restantes, 10 - n);
+
+    liberarFilaConcorrente(fila);
+    printf("Fila concorrente liberada.\n");
+    printf("-------------------------\n\n");
+}
+#endif // HEAP_TEM_FILA_CONCORRENTE
+
 /**
  * @brief Testa o algoritmo Heapsort.
  */
@@ -173,7 +742,366 @@ void testarHeapsort() {
     printf("-------------------------\n\n");
 }
 
-int main() {
+/**
+ * @brief Testa a seleção dos k pacientes mais urgentes.
+ */
+void testarTopK() {
+    printf("--- Testando Seleção Top-k ---\n");
+    Paciente pacientes[] = {
+        {121, 35}, {122, 90}, {123, 10}, {124, 75}, {125, 60},
+        {126, 95}, {127, 20}, {128, 80}, {129, 45}, {130, 5}
+    };
+    int n = sizeof(pacientes) / sizeof(pacientes[0]);
+    Paciente top[3];
+
+    int m = topKPacientes(pacientes, n, 3, top);
+    imprimirPacientesArray("topKPacientes (k = 3):", top, m);
+
+    AcumuladorTopK *acumulador = criarAcumuladorTopK(3);
+    if (acumulador) {
+        adicionarLoteTopK(acumulador, pacientes, 5);
+        m = consultarTopK(acumulador, top);
+        imprimirPacientesArray("Acumulador após os 5 primeiros pacientes:", top, m);
+        for (int i = 5; i < n; i++) {
+            adicionarPacienteTopK(acumulador, pacientes[i]);
+        }
+        m = consultarTopK(acumulador, top);
+        imprimirPacientesArray("Acumulador após todos os pacientes:", top, m);
+        liberarAcumuladorTopK(acumulador);
+    }
+
+    ordenarParcialPacientes(pacientes, n, 4);
+    imprimirPacientesArray("Ordenação parcial (4 mais urgentes no início):", pacientes, n);
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a heap indireta: as fichas completas ficam no slab e a heap
+ * ordena só referências; depois ordena um array de fichas por permutação.
+ */
+void testarHeapIndireta() {
+    printf("--- Testando Heap Indireta ---\n");
+    RegistroPaciente fichas[5] = {
+        {{501, 40}, "Ana Souza", "Clínica", {88, 130, 97, 368}, 1000},
+        {{502, 95}, "Bruno Lima", "Trauma", {132, 85, 89, 355}, 1200},
+        {{503, 70}, "Carla Dias", "Cardiologia", {110, 170, 94, 371}, 1500},
+        {{504, 15}, "Davi Rocha", "Ortopedia", {76, 120, 99, 366}, 1700},
+        {{505, 70}, "Elisa Prado", "Pediatria", {120, 100, 95, 389}, 2100},
+    };
+    HeapIndireta *heap = criarHeapIndireta(sizeof(RegistroPaciente));
+    if (!heap) {
+        printf("Falha ao criar a heap indireta. Teste abortado.\n");
+        return;
+    }
+    RefRegistro refs[5];
+    for (int i = 0; i < 5; i++) {
+        inserirHeapIndireta(heap, fichas[i].paciente.prioridade, &fichas[i], &refs[i]);
+    }
+    // A ficha é alterada no lugar, pela referência, sem mexer na heap
+    RegistroPaciente *ficha = (RegistroPaciente*) registroHeapIndireta(heap, refs[3]);
+    ficha->sinaisVitais[2] = 91;
+    printf("Fichas no slab: %lld (%zu bytes cada; a heap move pares de %zu bytes)\n",
+           (long long) heap->registros, sizeof(RegistroPaciente), sizeof(EntradaIndireta));
+    while (!heapIndiretaVazia(heap)) {
+        int prioridade;
+        RefRegistro ref = extrairMaxHeapIndireta(heap, &prioridade);
+        ficha = (RegistroPaciente*) registroHeapIndireta(heap, ref);
+        printf("  Ref %u -> Prioridade: %2d, %-12s (%s), SpO2 %d%%\n", (unsigned) ref, prioridade,
+               ficha->nome, ficha->ala, ficha->sinaisVitais[2]);
+        liberarRegistroHeapIndireta(heap, ref);
+    }
+    RefRegistro reaproveitada;
+    inserirHeapIndireta(heap, fichas[0].paciente.prioridade, &fichas[0], &reaproveitada);
+    printf("Nova ficha reaproveita o slot devolvido: ref %u\n", (unsigned) reaproveitada);
+    liberarHeapIndireta(heap);
+
+    uint32_t ordem[5];
+    if (heapsortIndireto(fichas, 5, sizeof(RegistroPaciente),
+                         offsetof(RegistroPaciente, paciente.prioridade), ordem) == HEAP_OK) {
+        printf("heapsortIndireto (permutação):");
+        for (int i = 0; i < 5; i++) {
+            printf(" %u:%s", (unsigned) ordem[i], fichas[ordem[i]].nome);
+        }
+        printf("\n");
+    }
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Testa a fusão de filas: pairing heap (O(1)) e MaxHeap (concatenação + Floyd).
+ */
+void testarFusao() {
+    printf("--- Testando Fusão de Filas ---\n");
+    PairingHeap *alaA = criarPairingHeap();
+    PairingHeap *alaB = criarPairingHeap();
+    MaxHeap *heapA = criarMaxHeapExpansivel(4);
+    MaxHeap *heapB = criarMaxHeapExpansivel(4);
+
+    if (!alaA || !alaB || !heapA || !heapB) {
+        printf("Falha ao criar as filas. Teste abortado.\n");
+        liberarPairingHeap(alaA);
+        liberarPairingHeap(alaB);
+        liberarMaxHeap(heapA);
+        liberarMaxHeap(heapB);
+        return;
+    }
+
+    Paciente ala1[] = {{151, 30}, {152, 75}, {153, 50}};
+    Paciente ala2[] = {{154, 90}, {155, 10}, {156, 60}};
+    for (int i = 0; i < 3; i++) {
+        inserirPacientePairing(alaA, ala1[i]);
+        inserirPacientePairing(alaB, ala2[i]);
+        inserirPacienteMax(heapA, ala1[i]);
+        inserirPacienteMax(heapB, ala2[i]);
+    }
+
+    fundirPairingHeaps(alaA, alaB);
+    fundirMaxHeaps(heapA, heapB);
+    printf("Pairing heap após a fusão (%d pacientes; ala B vazia: %s):\n",
+           alaA->tamanho, pairingHeapVazia(alaB) ? "sim" : "não");
+    while (!pairingHeapVazia(alaA)) {
+        Paciente p = extrairMaxPacientePairing(alaA);
+        printf("  Extraído -> ID: %3d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+    printf("MaxHeap após fundirMaxHeaps (%lld pacientes):\n", (long long) heapA->tamanho);
+    while (!maxHeapVazia(heapA)) {
+        Paciente p = extrairMaxPacienteHeap(heapA);
+        printf("  Extraído -> ID: %3d, Prioridade: %3d\n", p.id, p.prioridade);
+    }
+
+    liberarPairingHeap(alaA);
+    liberarPairingHeap(alaB);
+    liberarMaxHeap(heapA);
+    liberarMaxHeap(heapB);
+    printf("-------------------------\n\n");
+}
+
+void testarEstatisticas() {
+    printf("--- Testando Estatísticas da Heap ---\n");
+    MaxHeap *heap = criarMaxHeap(4);
+    if (heap == NULL) {
+        printf("Falha ao criar a heap. Teste abortado.\n");
+        return;
+    }
+    Paciente pacientes[] = {{161, 40}, {162, 85}, {163, 20}, {164, 70}, {165, 95}};
+    for (int i = 0; i < 5; i++) {
+        inserirPacienteMax(heap, pacientes[i]); // O quinto é recusado (capacidade 4)
+    }
+    while (!maxHeapVazia(heap)) {
+        extrairMaxPacienteHeap(heap);
+    }
+
+    EstatisticasHeap est;
+    obterEstatisticasMaxHeap(heap, &est);
+    if (est.instrumentada) {
+        printf("Inserções: %llu, extrações: %llu, comparações: %llu, movimentos: %llu\n",
+               est.operacoes[HEAP_OP_INSERIR], est.operacoes[HEAP_OP_EXTRAIR], est.comparacoes, est.movimentos);
+        printf("Níveis percorridos: %llu (máx. %llu), rejeições por heap cheia: %llu\n",
+               est.niveis, est.profundidadeMaxima, est.rejeicoesCheia);
+    } else {
+        printf("Biblioteca compilada sem HEAP_INSTRUMENTACAO (estatísticas zeradas).\n");
+    }
+    liberarMaxHeap(heap);
+    printf("-------------------------\n\n");
+}
+
+#ifdef HEAP_TEM_PERSISTENCIA
+/**
+ * @brief Testa a heap persistente: os pacientes sobrevivem ao fechamento do arquivo.
+ */
+void testarHeapPersistente() {
+    printf("--- Testando Heap Persistente ---\n");
+    const char *caminho = "fila_persistente.heap";
+    remove(caminho);
+
+    HeapPersistente *heap = abrirHeapPersistente(caminho, HEAP_PERSISTENTE_MAX, 2); // Cresce ao inserir
+    if (!heap) {
+        printf("Falha ao criar heap persistente. Teste abortado.\n");
+        printf("-------------------------\n\n");
+        return;
+    }
+    inserirPacientePersistente(heap, (Paciente){141, 40});
+    inserirPacientePersistente(heap, (Paciente){142, 85});
+    inserirPacientePersistente(heap, (Paciente){143, 15});
+    inserirPacientePersistente(heap, (Paciente){144, 70});
+    inserirPacientePersistente(heap, (Paciente){145, 55});
+    sincronizarHeapPersistente(heap);
+    printf("%d pacientes gravados em %s. Fechando...\n", tamanhoHeapPersistente(heap), caminho);
+    fecharHeapPersistente(heap);
+
+    heap = abrirHeapPersistente(caminho, HEAP_PERSISTENTE_MAX, 0);
+    if (!heap) {
+        printf("Falha ao reabrir heap persistente.\n");
+    } else {
+        printf("Reaberta com %d pacientes (sem reconstrução). Extraindo:\n", tamanhoHeapPersistente(heap));
+        while (!heapPersistenteVazia(heap)) {
+            Paciente p = extrairPacientePersistente(heap);
+            printf("  Extraído -> ID: %3d, Prioridade: %3d\n", p.id, p.prioridade);
+        }
+        fecharHeapPersistente(heap);
+    }
+    remove(caminho);
+    printf("-------------------------\n\n");
+}
+#endif // HEAP_TEM_PERSISTENCIA
+
+/**
+ * @brief Testa a ordenação externa de um arquivo binário de pacientes.
+ */
+void testarOrdenacaoExterna() {
+    printf("--- Testando Ordenação Externa ---\n");
+    const char *entrada = "pacientes_entrada.bin";
+    const char *saida = "pacientes_saida.bin";
+    Paciente pacientes[] = {
+        {51, 40}, {52, 10}, {53, 90}, {54, 25}, {55, 70},
+        {56, 15}, {57, 60}, {58, 35}, {59, 80}, {60, 5}
+    };
+    int n = sizeof(pacientes) / sizeof(pacientes[0]);
+
+    FILE *arquivo = fopen(entrada, "wb");
+    if (arquivo == NULL) {
+        printf("Não foi possível criar %s\n", entrada);
+        printf("-------------------------\n\n");
+        return;
+    }
+    fwrite(pacientes, sizeof(Paciente), (size_t) n, arquivo);
+    fclose(arquivo);
+    imprimirPacientesArray("Pacientes gravados em arquivo:", pacientes, n);
+
+    EstatisticasOrdenacaoExterna estatisticas;
+    int status = ordenarArquivoPacientes(entrada, saida, ORDENACAO_EXTERNA_MEMORIA_MINIMA, &estatisticas);
+    if (status != HEAP_OK) {
+        printf("Falha na ordenação externa (status %d)\n", status);
+    } else {
+        Paciente ordenados[10];
+        arquivo = fopen(saida, "rb");
+        int lidos = arquivo != NULL ? (int) fread(ordenados, sizeof(Paciente), 10, arquivo) : 0;
+        if (arquivo != NULL) fclose(arquivo);
+        printf("Corridas geradas: %d, passadas de intercalação: %d\n",
+               estatisticas.corridas, estatisticas.passadas);
+        imprimirPacientesArray("Arquivo ordenado (prioridade ascendente):", ordenados, lidos);
+    }
+    remove(entrada);
+    remove(saida);
+    printf("-------------------------\n\n");
+}
+
+/**
+ * @brief Imprime as opções de linha de comando (sem opções, roda as demonstrações).
+ */
+static void imprimirUso(const char *programa) {
+    printf("Uso: %s                      roda as demonstrações\n", programa);
+    printf("     %s --replay ARQUIVO [--backend NOME]\n", programa);
+    printf("     %s --gerar-trace ARQUIVO [--operacoes N] [--semente S] [--texto]\n", programa);
+    printf("  --replay ARQUIVO     executa o trace (\"-\" lê da entrada padrão)\n");
+    printf("  --backend NOME       max_heap (padrão), dary_heap, indexed_heap, pairing_heap,\n");
+    printf("                       fila_baldes, heap_min_max ou todos (só com arquivo)\n");
+    printf("  --gerar-trace ARQ    gera um trace sintético com rajadas de chegada (\"-\" = saída padrão)\n");
+    printf("  --operacoes N        operações do trace gerado (padrão 1000000)\n");
+    printf("  --semente S          semente do gerador (padrão 1)\n");
+    printf("  --texto              gera o trace em texto em vez de binário\n");
+}
+
+/**
+ * @brief Executa o replay de um trace contra uma fila (ou todas, reabrindo o
+ * arquivo para cada uma) e imprime os resultados.
+ */
+static int executarModoReplay(const char *caminho, const char *backend) {
+    int todos = strcmp(backend, "todos") == 0;
+    BackendReplay escolhido = REPLAY_MAX_HEAP;
+    if (!todos && backendReplayPorNome(backend, &escolhido) != HEAP_OK) {
+        fprintf(stderr, "Fila desconhecida: %s\n", backend);
+        return EXIT_FAILURE;
+    }
+    if (todos && strcmp(caminho, "-") == 0) {
+        fprintf(stderr, "--backend todos precisa de um arquivo (a entrada padrão só pode ser lida uma vez)\n");
+        return EXIT_FAILURE;
+    }
+    ResultadoReplay *resultado = (ResultadoReplay*) malloc(sizeof(ResultadoReplay));
+    if (resultado == NULL) {
+        perror("Falha ao alocar memória para o resultado do replay");
+        return EXIT_FAILURE;
+    }
+    int codigo = EXIT_SUCCESS;
+    for (int b = todos ? 0 : (int) escolhido; b < (todos ? REPLAY_QUANTIDADE : (int) escolhido + 1); b++) {
+        LeitorTrace *leitor = abrirLeitorTrace(caminho);
+        if (leitor == NULL) {
+            codigo = EXIT_FAILURE;
+            break;
+        }
+        int status = executarReplay(leitor, (BackendReplay) b, resultado);
+        fecharLeitorTrace(leitor);
+        if (status == HEAP_ERRO_PARAMETRO) {
+            // Ex.: faixa de prioridades grande demais para a fila por baldes
+            if (todos) {
+                continue;
+            }
+            codigo = EXIT_FAILURE;
+            break;
+        }
+        imprimirResultadoReplay(resultado, stdout);
+        if (status != HEAP_OK) {
+            fprintf(stderr, "Replay interrompido (código %d)\n", status);
+            codigo = EXIT_FAILURE;
+            break;
+        }
+    }
+    free(resultado);
+    return codigo;
+}
+
+/**
+ * @brief Trata os modos de linha de comando (replay e geração de traces).
+ */
+static int executarLinhaDeComando(int argc, char *argv[]) {
+    const char *replay = NULL;
+    const char *gerar = NULL;
+    const char *backend = "max_heap";
+    int binario = 1;
+    ParametrosTrace parametros;
+    parametrosTracePadrao(&parametros);
+
+    for (int i = 1; i < argc; i++) {
+        int temValor = i + 1 < argc;
+        if (strcmp(argv[i], "--replay") == 0 && temValor) {
+            replay = argv[++i];
+        } else if (strcmp(argv[i], "--backend") == 0 && temValor) {
+            backend = argv[++i];
+        } else if (strcmp(argv[i], "--gerar-trace") == 0 && temValor) {
+            gerar = argv[++i];
+        } else if (strcmp(argv[i], "--operacoes") == 0 && temValor) {
+            parametros.operacoes = atoll(argv[++i]);
+        } else if (strcmp(argv[i], "--semente") == 0 && temValor) {
+            parametros.semente = (unsigned int) strtoul(argv[++i], NULL, 10);
+        } else if (strcmp(argv[i], "--texto") == 0) {
+            binario = 0;
+        } else {
+            imprimirUso(argv[0]);
+            return strcmp(argv[i], "--ajuda") == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+    }
+    if (gerar != NULL) {
+        int status = gerarTraceSintetico(gerar, binario, &parametros);
+        if (status != HEAP_OK) {
+            fprintf(stderr, "Falha ao gerar o trace (código %d)\n", status);
+            return EXIT_FAILURE;
+        }
+    }
+    if (replay != NULL) {
+        return executarModoReplay(replay, backend);
+    }
+    if (gerar == NULL) {
+        imprimirUso(argv[0]);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+int main(int argc, char *argv[]) {
+    if (argc > 1) {
+        return executarLinhaDeComando(argc, argv);
+    }
+
     printf("=====================================================\n");
     // A mensagem original mencionava a professora Elanne, você pode ajustar conforme necessário.
     printf("Iniciando Testes das Estruturas de Heap e Heapsort\n");
@@ -181,7 +1109,32 @@ int main() {
 
     testarMaxHeap();
     testarMinHeap();
+    testarHeapExpansivel();
+    testarAlocacaoHeaps();
+    testarPaginasGrandes();
+    testarConstrucaoEmLote();
+    testarExtracaoEmLote();
+    testarInsercaoAdiada();
+    testarDaryHeap();
+    testarIndexedHeap();
+    testarHeapChegada();
+    testarHeapEstavel();
+    testarFilaBaldes();
+    testarHeapMinMax();
+    testarFilaEnvelhecimento();
+#ifdef HEAP_TEM_FILA_CONCORRENTE
+    testarFilaConcorrente();
+#endif
     testarHeapsort();
+    testarOrdenacaoRadix();
+    testarTopK();
+    testarFusao();
+    testarHeapIndireta();
+    testarEstatisticas();
+#ifdef HEAP_TEM_PERSISTENCIA
+    testarHeapPersistente();
+#endif
+    testarOrdenacaoExterna();
 
     printf("=====================================================\n");
     printf("Todos os testes foram concluídos.\n");
@@ -3,29 +3,184 @@
 
 #include <stdio.h>
 #include <stdlib.h> // Para malloc, free, exit
-#include "includes\paciente.h" // Inclui a definição da struct Paciente
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+#include "includes/heap_indice.h" // HeapIndice (int ou 64 bits com HEAP_LARGA_ESCALA)
+#include "includes/heap_estatisticas.h" // Instrumentação opcional (HEAP_INSTRUMENTACAO)
+#include "arena_heaps/arena_heaps.h" // ArenaHeaps (criação de heaps em lote)
+#include "paginas_grandes/paginas_grandes.h" // ModoPaginas (array em páginas grandes)
 
 // Estrutura para a Max-Heap
 typedef struct {
     Paciente *array; // Ponteiro para o array de pacientes
-    int tamanho;     // Número atual de pacientes na heap
-    int capacidade;  // Capacidade máxima da heap
+    HeapIndice tamanho;    // Número atual de pacientes na heap
+    HeapIndice capacidade; // Capacidade atual do array
+    int expansivel;  // 1 se o array cresce automaticamente quando cheio
+    int arrayEmprestado; // 1 se o array não veio de malloc (bloco único, memória do chamador ou arena)
+    ModoPaginas paginas; // Como o array próprio é alocado (ver definirPaginasMaxHeap)
+    HeapIndice pendentes;      // Inserções adiadas ainda fora da heap, no fim do array
+    HeapIndice melhorPendente; // Índice do pendente de maior prioridade (se pendentes > 0)
+    int insercaoAdiada;        // 1 se inserirPacienteMax só acumula (ver definirInsercaoAdiadaMaxHeap)
+#ifdef HEAP_INSTRUMENTACAO
+    EstatisticasHeap estatisticas; // Contadores e histogramas de latência
+#endif
 } MaxHeap;
 
 /**
- * @brief Cria uma nova Max-Heap.
+ * @brief Cria uma nova Max-Heap de capacidade fixa.
+ * A struct e o array ficam em um único bloco (uma alocação e um free).
  * @param capacidade A capacidade máxima da heap.
  * @return Ponteiro para a MaxHeap criada, ou NULL em caso de falha.
  */
-MaxHeap* criarMaxHeap(int capacidade);
+MaxHeap* criarMaxHeap(HeapIndice capacidade);
+
+/**
+ * @brief Cria uma nova Max-Heap expansível.
+ * Quando cheia, a capacidade é dobrada na próxima inserção (custo amortizado O(1)
+ * por realocação). O array inicial fica no mesmo bloco da struct; ao crescer
+ * além dele, os pacientes passam para um array próprio.
+ * @param capacidadeInicial Capacidade inicial do array (pode ser 0).
+ * @return Ponteiro para a MaxHeap criada, ou NULL em caso de falha.
+ */
+MaxHeap* criarMaxHeapExpansivel(HeapIndice capacidadeInicial);
+
+/**
+ * @brief Inicializa uma Max-Heap em memória do chamador (ex.: na pilha ou
+ * dentro de outra struct), sem alocar. O array 'armazenamento' é usado
+ * enquanto couber; uma heap expansível que crescer além dele passa a usar um
+ * array próprio, devolvido por finalizarMaxHeap.
+ * @param heap A MaxHeap a inicializar.
+ * @param armazenamento Array para os pacientes (pode ser NULL se capacidade for 0).
+ * @param capacidade Número de pacientes que cabem em 'armazenamento'.
+ * @param expansivel 1 para crescer automaticamente quando cheia.
+ * @return HEAP_OK ou HEAP_ERRO_PARAMETRO.
+ */
+int inicializarMaxHeap(MaxHeap *heap, Paciente armazenamento[], HeapIndice capacidade, int expansivel);
+
+/**
+ * @brief Libera o array próprio de uma Max-Heap inicializada com
+ * inicializarMaxHeap (se ela cresceu) e a deixa vazia e sem capacidade. Não
+ * libera a struct nem 'armazenamento'.
+ * @param heap Ponteiro para a MaxHeap.
+ */
+void finalizarMaxHeap(MaxHeap *heap);
+
+/**
+ * @brief Cria uma Max-Heap (struct e array contíguos) recortada de uma arena.
+ * Não deve ser passada a liberarMaxHeap: é liberada junto com a arena, que
+ * também devolve o array próprio se a heap tiver crescido.
+ * @param arena A ArenaHeaps de onde recortar a heap.
+ * @param capacidade Capacidade inicial do array.
+ * @param expansivel 1 para crescer automaticamente quando cheia.
+ * @return Ponteiro para a MaxHeap criada, ou NULL em caso de falha.
+ */
+MaxHeap* criarMaxHeapNaArena(ArenaHeaps *arena, HeapIndice capacidade, int expansivel);
 
 /**
  * @brief Insere um paciente na Max-Heap.
- * A propriedade da heap é mantida.
+ * A propriedade da heap é mantida. Em heaps expansíveis o array é dobrado
+ * quando cheio; em heaps de capacidade fixa a inserção é rejeitada. Com a
+ * inserção adiada ligada, o paciente só é acrescentado ao fim do array (O(1))
+ * e entra na heap na próxima extração.
  * @param heap Ponteiro para a MaxHeap.
  * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_CHEIA (capacidade fixa esgotada),
+ * HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacienteMax(MaxHeap *heap, Paciente p);
+
+/**
+ * @brief Garante que a Max-Heap comporte ao menos 'capacidade' pacientes.
+ * Funciona também em heaps de capacidade fixa (reserva explícita).
+ * @param heap Ponteiro para a MaxHeap.
+ * @param capacidade Capacidade mínima desejada.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO (inclusive
+ * capacidade acima de HEAP_TAMANHO_MAX).
+ */
+int reservarMaxHeap(MaxHeap *heap, HeapIndice capacidade);
+
+/**
+ * @brief Reduz a capacidade da Max-Heap ao número atual de pacientes.
+ * Não tem efeito enquanto o array é emprestado (bloco único, memória do
+ * chamador ou arena).
+ * @param heap Ponteiro para a MaxHeap.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int encolherMaxHeap(MaxHeap *heap);
+
+/**
+ * @brief Escolhe como o array próprio da Max-Heap é alocado: malloc
+ * (PAGINAS_NORMAIS, o padrão) ou páginas grandes, que reduzem as falhas de
+ * TLB em heaps com centenas de milhões de pacientes ou mais. Um array próprio
+ * já existente é copiado para o novo modo; um array emprestado continua em uso
+ * e o modo vale quando a heap passar a ter array próprio (ex.: logo após
+ * criarMaxHeapExpansivel(0), o próximo reservarMaxHeap já aloca no modo novo).
+ * @param heap Ponteiro para a MaxHeap.
+ * @param modo PAGINAS_NORMAIS, PAGINAS_TRANSPARENTES ou PAGINAS_EXPLICITAS.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA (heap inalterada) ou HEAP_ERRO_PARAMETRO.
+ */
+int definirPaginasMaxHeap(MaxHeap *heap, ModoPaginas modo);
+
+/**
+ * @brief Liga ou desliga a inserção adiada, para rajadas de chegadas (ex.:
+ * ambulâncias) entre extrações. Ligada, inserirPacienteMax acumula os pacientes
+ * fora de ordem no fim do array; a extração seguinte os incorpora de uma vez,
+ * com reconstrução de Floyd se forem muitos em relação à heap ou heapify-up um
+ * a um caso contrário (o mesmo critério de inserirLoteMax). espiarMaxPaciente
+ * continua O(1). Desligar incorpora os pendentes na hora.
+ * @param heap Ponteiro para a MaxHeap.
+ * @param adiada 1 para ligar, 0 para desligar.
+ * @return HEAP_OK ou HEAP_ERRO_PARAMETRO.
+ */
+int definirInsercaoAdiadaMaxHeap(MaxHeap *heap, int adiada);
+
+/**
+ * @brief Cria uma Max-Heap a partir de um array existente em tempo O(n)
+ * (construção bottom-up de Floyd).
+ * A heap resultante é expansível.
+ * @param array O array de Pacientes.
+ * @param n O número de elementos no array.
+ * @param adotar Se diferente de 0, a heap assume a posse de 'array' (que deve
+ * ter sido alocado com malloc) e o reorganiza in-place; caso contrário, os
+ * pacientes são copiados e 'array' não é alterado.
+ * @return Ponteiro para a MaxHeap criada, ou NULL em caso de falha.
+ */
+MaxHeap* criarMaxHeapDeArray(Paciente array[], HeapIndice n, int adotar);
+
+/**
+ * @brief Insere um lote de pacientes na Max-Heap.
+ * Lotes grandes em relação à heap são inseridos com uma reconstrução de Floyd
+ * em tempo linear; lotes pequenos usam heapify-up individual.
+ * @param heap Ponteiro para a MaxHeap.
+ * @param lote O array de Pacientes a inserir.
+ * @param k O número de pacientes no lote.
+ * @return HEAP_OK, HEAP_ERRO_CHEIA (capacidade fixa insuficiente; nada é
+ * inserido), HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirLoteMax(MaxHeap *heap, const Paciente lote[], HeapIndice k);
+
+/**
+ * @brief Funde 'origem' em 'destino' (meld): os pacientes de 'origem' passam a
+ * 'destino' e 'origem' fica vazia. Concatena os arrays e reconstrói com Floyd
+ * em O(n + m) (ou usa heapify-up se 'origem' for pequena; ver inserirLoteMax).
+ * Se as duas heaps forem expansíveis e 'origem' for maior, os arrays são
+ * trocados antes, de modo que a menor é que é copiada.
+ * @param destino Ponteiro para a MaxHeap que recebe os pacientes.
+ * @param origem Ponteiro para a MaxHeap esvaziada.
+ * @return HEAP_OK, HEAP_ERRO_CHEIA (capacidade fixa insuficiente; nada é
+ * alterado), HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
  */
-void inserirPacienteMax(MaxHeap *heap, Paciente p);
+int fundirMaxHeaps(MaxHeap *destino, MaxHeap *origem);
+
+/**
+ * @brief Retorna, sem remover, o paciente com a maior prioridade da Max-Heap.
+ * Em O(1) mesmo com inserções adiadas pendentes (compara a raiz com o maior
+ * pendente, sem incorporá-los).
+ * @param heap Ponteiro para a MaxHeap.
+ * @return O Paciente com a maior prioridade. Se a heap estiver vazia,
+ * retorna um Paciente com id e prioridade -1.
+ */
+Paciente espiarMaxPacienteHeap(const MaxHeap *heap);
 
 /**
  * @brief Extrai e retorna o paciente com a maior prioridade da Max-Heap.
@@ -36,6 +191,19 @@ void inserirPacienteMax(MaxHeap *heap, Paciente p);
  */
 Paciente extrairMaxPacienteHeap(MaxHeap *heap);
 
+/**
+ * @brief Extrai de uma vez os k pacientes de maior prioridade, em ordem
+ * decrescente (ex.: troca de turno). Equivale a k chamadas de extrairMaxPacienteHeap
+ * (é o caminho mais rápido para prioridades int; ver HEAP_COMPARACAO_CARA em
+ * heap_generico.h), com uma única consolidação e uma única chamada.
+ * @param heap Ponteiro para a MaxHeap.
+ * @param k Número de pacientes desejado.
+ * @param saida Recebe os pacientes extraídos (espaço para k).
+ * @return Número de pacientes extraídos (o menor entre k e o tamanho da heap)
+ * ou HEAP_ERRO_PARAMETRO.
+ */
+HeapIndice extrairLoteMax(MaxHeap *heap, HeapIndice k, Paciente saida[]);
+
 /**
  * @brief Verifica se a Max-Heap está vazia.
  * @param heap Ponteiro para a MaxHeap.
@@ -44,7 +212,25 @@ Paciente extrairMaxPacienteHeap(MaxHeap *heap);
 int maxHeapVazia(MaxHeap *heap);
 
 /**
- * @brief Libera a memória alocada para a Max-Heap.
+ * @brief Copia as estatísticas acumuladas da Max-Heap (comparações, movimentos,
+ * níveis percorridos, crescimentos, rejeições por heap cheia e histogramas de
+ * latência por operação). Sem HEAP_INSTRUMENTACAO, 'saida' é zerada e
+ * saida->instrumentada fica 0.
+ * @param heap Ponteiro para a MaxHeap.
+ * @param saida Recebe as estatísticas.
+ * @return HEAP_OK ou HEAP_ERRO_PARAMETRO.
+ */
+int obterEstatisticasMaxHeap(const MaxHeap *heap, EstatisticasHeap *saida);
+
+/**
+ * @brief Zera as estatísticas acumuladas da Max-Heap.
+ * @param heap Ponteiro para a MaxHeap.
+ */
+void zerarEstatisticasMaxHeap(MaxHeap *heap);
+
+/**
+ * @brief Libera a memória alocada para a Max-Heap criada com criarMaxHeap,
+ * criarMaxHeapExpansivel ou criarMaxHeapDeArray.
  * @param heap Ponteiro para a MaxHeap a ser liberada.
  */
 void liberarMaxHeap(MaxHeap *heap);
@@ -66,6 +252,6 @@ void trocarPacientes(Paciente *a, Paciente *b);
  * @param n O tamanho da porção do array considerada como heap.
  * @param i O índice da raiz da subárvore a ser "heapificada".
  */
-void heapifyDownMaxArray(Paciente array[], int n, int i);
+void heapifyDownMaxArray(Paciente array[], HeapIndice n, HeapIndice i);
 
 #endif // MAX_HEAP_H
\ No newline at end of file
@@ -3,29 +3,184 @@
 
 #include <stdio.h>
 #include <stdlib.h> // Para malloc, free, exit
-#include "includes\paciente.h" // Inclui a definição da struct Paciente
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+#include "includes/heap_indice.h" // HeapIndice (int ou 64 bits com HEAP_LARGA_ESCALA)
+#include "includes/heap_estatisticas.h" // Instrumentação opcional (HEAP_INSTRUMENTACAO)
+#include "arena_heaps/arena_heaps.h" // ArenaHeaps (criação de heaps em lote)
+#include "paginas_grandes/paginas_grandes.h" // ModoPaginas (array em páginas grandes)
 
 // Estrutura para a Min-Heap
 typedef struct {
     Paciente *array; // Ponteiro para o array de pacientes
-    int tamanho;     // Número atual de pacientes na heap
-    int capacidade;  // Capacidade máxima da heap
+    HeapIndice tamanho;    // Número atual de pacientes na heap
+    HeapIndice capacidade; // Capacidade atual do array
+    int expansivel;  // 1 se o array cresce automaticamente quando cheio
+    int arrayEmprestado; // 1 se o array não veio de malloc (bloco único, memória do chamador ou arena)
+    ModoPaginas paginas; // Como o array próprio é alocado (ver definirPaginasMinHeap)
+    HeapIndice pendentes;      // Inserções adiadas ainda fora da heap, no fim do array
+    HeapIndice melhorPendente; // Índice do pendente de menor prioridade (se pendentes > 0)
+    int insercaoAdiada;        // 1 se inserirPacienteMin só acumula (ver definirInsercaoAdiadaMinHeap)
+#ifdef HEAP_INSTRUMENTACAO
+    EstatisticasHeap estatisticas; // Contadores e histogramas de latência
+#endif
 } MinHeap;
 
 /**
- * @brief Cria uma nova Min-Heap.
+ * @brief Cria uma nova Min-Heap de capacidade fixa.
+ * A struct e o array ficam em um único bloco (uma alocação e um free).
  * @param capacidade A capacidade máxima da heap.
  * @return Ponteiro para a MinHeap criada, ou NULL em caso de falha.
  */
-MinHeap* criarMinHeap(int capacidade);
+MinHeap* criarMinHeap(HeapIndice capacidade);
+
+/**
+ * @brief Cria uma nova Min-Heap expansível.
+ * Quando cheia, a capacidade é dobrada na próxima inserção (custo amortizado O(1)
+ * por realocação). O array inicial fica no mesmo bloco da struct; ao crescer
+ * além dele, os pacientes passam para um array próprio.
+ * @param capacidadeInicial Capacidade inicial do array (pode ser 0).
+ * @return Ponteiro para a MinHeap criada, ou NULL em caso de falha.
+ */
+MinHeap* criarMinHeapExpansivel(HeapIndice capacidadeInicial);
+
+/**
+ * @brief Inicializa uma Min-Heap em memória do chamador (ex.: na pilha ou
+ * dentro de outra struct), sem alocar. O array 'armazenamento' é usado
+ * enquanto couber; uma heap expansível que crescer além dele passa a usar um
+ * array próprio, devolvido por finalizarMinHeap.
+ * @param heap A MinHeap a inicializar.
+ * @param armazenamento Array para os pacientes (pode ser NULL se capacidade for 0).
+ * @param capacidade Número de pacientes que cabem em 'armazenamento'.
+ * @param expansivel 1 para crescer automaticamente quando cheia.
+ * @return HEAP_OK ou HEAP_ERRO_PARAMETRO.
+ */
+int inicializarMinHeap(MinHeap *heap, Paciente armazenamento[], HeapIndice capacidade, int expansivel);
+
+/**
+ * @brief Libera o array próprio de uma Min-Heap inicializada com
+ * inicializarMinHeap (se ela cresceu) e a deixa vazia e sem capacidade. Não
+ * libera a struct nem 'armazenamento'.
+ * @param heap Ponteiro para a MinHeap.
+ */
+void finalizarMinHeap(MinHeap *heap);
+
+/**
+ * @brief Cria uma Min-Heap (struct e array contíguos) recortada de uma arena.
+ * Não deve ser passada a liberarMinHeap: é liberada junto com a arena, que
+ * também devolve o array próprio se a heap tiver crescido.
+ * @param arena A ArenaHeaps de onde recortar a heap.
+ * @param capacidade Capacidade inicial do array.
+ * @param expansivel 1 para crescer automaticamente quando cheia.
+ * @return Ponteiro para a MinHeap criada, ou NULL em caso de falha.
+ */
+MinHeap* criarMinHeapNaArena(ArenaHeaps *arena, HeapIndice capacidade, int expansivel);
 
 /**
  * @brief Insere um paciente na Min-Heap.
- * A propriedade da heap é mantida.
+ * A propriedade da heap é mantida. Em heaps expansíveis o array é dobrado
+ * quando cheio; em heaps de capacidade fixa a inserção é rejeitada. Com a
+ * inserção adiada ligada, o paciente só é acrescentado ao fim do array (O(1))
+ * e entra na heap na próxima extração.
  * @param heap Ponteiro para a MinHeap.
  * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_CHEIA (capacidade fixa esgotada),
+ * HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
  */
-void inserirPacienteMin(MinHeap *heap, Paciente p);
+int inserirPacienteMin(MinHeap *heap, Paciente p);
+
+/**
+ * @brief Garante que a Min-Heap comporte ao menos 'capacidade' pacientes.
+ * Funciona também em heaps de capacidade fixa (reserva explícita).
+ * @param heap Ponteiro para a MinHeap.
+ * @param capacidade Capacidade mínima desejada.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO (inclusive
+ * capacidade acima de HEAP_TAMANHO_MAX).
+ */
+int reservarMinHeap(MinHeap *heap, HeapIndice capacidade);
+
+/**
+ * @brief Reduz a capacidade da Min-Heap ao número atual de pacientes.
+ * Não tem efeito enquanto o array é emprestado (bloco único, memória do
+ * chamador ou arena).
+ * @param heap Ponteiro para a MinHeap.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int encolherMinHeap(MinHeap *heap);
+
+/**
+ * @brief Escolhe como o array próprio da Min-Heap é alocado: malloc
+ * (PAGINAS_NORMAIS, o padrão) ou páginas grandes, que reduzem as falhas de
+ * TLB em heaps com centenas de milhões de pacientes ou mais. Um array próprio
+ * já existente é copiado para o novo modo; um array emprestado continua em uso
+ * e o modo vale quando a heap passar a ter array próprio (ex.: logo após
+ * criarMinHeapExpansivel(0), o próximo reservarMinHeap já aloca no modo novo).
+ * @param heap Ponteiro para a MinHeap.
+ * @param modo PAGINAS_NORMAIS, PAGINAS_TRANSPARENTES ou PAGINAS_EXPLICITAS.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA (heap inalterada) ou HEAP_ERRO_PARAMETRO.
+ */
+int definirPaginasMinHeap(MinHeap *heap, ModoPaginas modo);
+
+/**
+ * @brief Liga ou desliga a inserção adiada, para rajadas de chegadas (ex.:
+ * ambulâncias) entre extrações. Ligada, inserirPacienteMin acumula os pacientes
+ * fora de ordem no fim do array; a extração seguinte os incorpora de uma vez,
+ * com reconstrução de Floyd se forem muitos em relação à heap ou heapify-up um
+ * a um caso contrário (o mesmo critério de inserirLoteMin). espiarMinPaciente
+ * continua O(1). Desligar incorpora os pendentes na hora.
+ * @param heap Ponteiro para a MinHeap.
+ * @param adiada 1 para ligar, 0 para desligar.
+ * @return HEAP_OK ou HEAP_ERRO_PARAMETRO.
+ */
+int definirInsercaoAdiadaMinHeap(MinHeap *heap, int adiada);
+
+/**
+ * @brief Cria uma Min-Heap a partir de um array existente em tempo O(n)
+ * (construção bottom-up de Floyd).
+ * A heap resultante é expansível.
+ * @param array O array de Pacientes.
+ * @param n O número de elementos no array.
+ * @param adotar Se diferente de 0, a heap assume a posse de 'array' (que deve
+ * ter sido alocado com malloc) e o reorganiza in-place; caso contrário, os
+ * pacientes são copiados e 'array' não é alterado.
+ * @return Ponteiro para a MinHeap criada, ou NULL em caso de falha.
+ */
+MinHeap* criarMinHeapDeArray(Paciente array[], HeapIndice n, int adotar);
+
+/**
+ * @brief Insere um lote de pacientes na Min-Heap.
+ * Lotes grandes em relação à heap são inseridos com uma reconstrução de Floyd
+ * em tempo linear; lotes pequenos usam heapify-up individual.
+ * @param heap Ponteiro para a MinHeap.
+ * @param lote O array de Pacientes a inserir.
+ * @param k O número de pacientes no lote.
+ * @return HEAP_OK, HEAP_ERRO_CHEIA (capacidade fixa insuficiente; nada é
+ * inserido), HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirLoteMin(MinHeap *heap, const Paciente lote[], HeapIndice k);
+
+/**
+ * @brief Funde 'origem' em 'destino' (meld): os pacientes de 'origem' passam a
+ * 'destino' e 'origem' fica vazia. Concatena os arrays e reconstrói com Floyd
+ * em O(n + m) (ou usa heapify-up se 'origem' for pequena; ver inserirLoteMin).
+ * Se as duas heaps forem expansíveis e 'origem' for maior, os arrays são
+ * trocados antes, de modo que a menor é que é copiada.
+ * @param destino Ponteiro para a MinHeap que recebe os pacientes.
+ * @param origem Ponteiro para a MinHeap esvaziada.
+ * @return HEAP_OK, HEAP_ERRO_CHEIA (capacidade fixa insuficiente; nada é
+ * alterado), HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int fundirMinHeaps(MinHeap *destino, MinHeap *origem);
+
+/**
+ * @brief Retorna, sem remover, o paciente com a menor prioridade da Min-Heap.
+ * Em O(1) mesmo com inserções adiadas pendentes (compara a raiz com o menor
+ * pendente, sem incorporá-los).
+ * @param heap Ponteiro para a MinHeap.
+ * @return O Paciente com a menor prioridade. Se a heap estiver vazia,
+ * retorna um Paciente com id e prioridade -1.
+ */
+Paciente espiarMinPacienteHeap(const MinHeap *heap);
 
 /**
  * @brief Extrai e retorna o paciente com a menor prioridade da Min-Heap.
@@ -36,6 +191,19 @@ void inserirPacienteMin(MinHeap *heap, Paciente p);
  */
 Paciente extrairMinPacienteHeap(MinHeap *heap);
 
+/**
+ * @brief Extrai de uma vez os k pacientes de menor prioridade, em ordem
+ * crescente (ex.: troca de turno). Equivale a k chamadas de extrairMinPacienteHeap
+ * (é o caminho mais rápido para prioridades int; ver HEAP_COMPARACAO_CARA em
+ * heap_generico.h), com uma única consolidação e uma única chamada.
+ * @param heap Ponteiro para a MinHeap.
+ * @param k Número de pacientes desejado.
+ * @param saida Recebe os pacientes extraídos (espaço para k).
+ * @return Número de pacientes extraídos (o menor entre k e o tamanho da heap)
+ * ou HEAP_ERRO_PARAMETRO.
+ */
+HeapIndice extrairLoteMin(MinHeap *heap, HeapIndice k, Paciente saida[]);
+
 /**
  * @brief Verifica se a Min-Heap está vazia.
  * @param heap Ponteiro para a MinHeap.
@@ -44,7 +212,25 @@ Paciente extrairMinPacienteHeap(MinHeap *heap);
 int minHeapVazia(MinHeap *heap);
 
 /**
- * @brief Libera a memória alocada para a Min-Heap.
+ * @brief Copia as estatísticas acumuladas da Min-Heap (comparações, movimentos,
+ * níveis percorridos, crescimentos, rejeições por heap cheia e histogramas de
+ * latência por operação). Sem HEAP_INSTRUMENTACAO, 'saida' é zerada e
+ * saida->instrumentada fica 0.
+ * @param heap Ponteiro para a MinHeap.
+ * @param saida Recebe as estatísticas.
+ * @return HEAP_OK ou HEAP_ERRO_PARAMETRO.
+ */
+int obterEstatisticasMinHeap(const MinHeap *heap, EstatisticasHeap *saida);
+
+/**
+ * @brief Zera as estatísticas acumuladas da Min-Heap.
+ * @param heap Ponteiro para a MinHeap.
+ */
+void zerarEstatisticasMinHeap(MinHeap *heap);
+
+/**
+ * @brief Libera a memória alocada para a Min-Heap criada com criarMinHeap,
+ * criarMinHeapExpansivel ou criarMinHeapDeArray.
  * @param heap Ponteiro para a MinHeap a ser liberada.
  */
 void liberarMinHeap(MinHeap *heap);
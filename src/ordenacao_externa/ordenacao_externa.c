@@ -0,0 +1,345 @@
+#include "ordenacao_externa.h"
+#include "heap_generico/heap_generico.h"
+#include "min_heap/min_heap.h" // Fronteira da intercalação
+#include <stdio.h>
+#include <stdlib.h>
+
+// Instância do motor genérico só com as operações sobre array (Min-Heap) para
+// a seleção por substituição, que precisa trocar a raiz em um único heapify-down.
+HEAP_GERAR_ARRAY(externaMin, Paciente, PACIENTE_MENOR)
+
+// Menor buffer de leitura por corrida durante a intercalação
+#define BUFFER_CORRIDA_MINIMO ((size_t) 64 * 1024)
+
+// Leitura sequencial de Pacientes em blocos grandes
+typedef struct {
+    FILE *arquivo;
+    Paciente *buffer;
+    size_t capacidade; // Em registros
+    size_t quantidade; // Registros válidos no buffer
+    size_t posicao;    // Próximo registro a entregar
+    int erro;
+} LeitorPacientes;
+
+// Escrita sequencial de Pacientes em blocos grandes
+typedef struct {
+    FILE *arquivo;
+    Paciente *buffer;
+    size_t capacidade;
+    size_t quantidade;
+    int erro;
+} EscritorPacientes;
+
+static int iniciarLeitor(LeitorPacientes *leitor, FILE *arquivo, size_t capacidade) {
+    leitor->arquivo = arquivo;
+    leitor->capacidade = capacidade > 0 ? capacidade : 1;
+    leitor->quantidade = 0;
+    leitor->posicao = 0;
+    leitor->erro = 0;
+    leitor->buffer = (Paciente*) malloc(leitor->capacidade * sizeof(Paciente));
+    return leitor->buffer != NULL;
+}
+
+/**
+ * @brief Lê o próximo paciente.
+ * @return 1 se um paciente foi lido, 0 no fim do arquivo ou em erro
+ * (leitor->erro indica qual). Um registro final incompleto (tamanho do arquivo
+ * que não é múltiplo de sizeof(Paciente)) é erro, não fim do arquivo.
+ */
+static int lerPaciente(LeitorPacientes *leitor, Paciente *p) {
+    if (leitor->posicao == leitor->quantidade) {
+        // Lido em bytes: fread por registro descartaria a sobra em silêncio
+        size_t bytes = fread(leitor->buffer, 1, leitor->capacidade * sizeof(Paciente), leitor->arquivo);
+        leitor->quantidade = bytes / sizeof(Paciente);
+        leitor->posicao = 0;
+        if (bytes % sizeof(Paciente) != 0) {
+            leitor->erro = 1;
+        }
+        if (leitor->quantidade == 0 || leitor->erro) {
+            leitor->erro |= ferror(leitor->arquivo) != 0;
+            leitor->quantidade = 0;
+            return 0;
+        }
+    }
+    *p = leitor->buffer[leitor->posicao++];
+    return 1;
+}
+
+static int iniciarEscritor(EscritorPacientes *escritor, FILE *arquivo, size_t capacidade) {
+    escritor->arquivo = arquivo;
+    escritor->capacidade = capacidade > 0 ? capacidade : 1;
+    escritor->quantidade = 0;
+    escritor->erro = 0;
+    escritor->buffer = (Paciente*) malloc(escritor->capacidade * sizeof(Paciente));
+    return escritor->buffer != NULL;
+}
+
+static void descarregarEscritor(EscritorPacientes *escritor) {
+    if (escritor->quantidade > 0 &&
+        fwrite(escritor->buffer, sizeof(Paciente), escritor->quantidade, escritor->arquivo) != escritor->quantidade) {
+        escritor->erro = 1;
+    }
+    escritor->quantidade = 0;
+}
+
+static void escreverPaciente(EscritorPacientes *escritor, Paciente p) {
+    if (escritor->quantidade == escritor->capacidade) {
+        descarregarEscritor(escritor);
+    }
+    escritor->buffer[escritor->quantidade++] = p;
+}
+
+// Lista de arquivos temporários (corridas ordenadas)
+typedef struct {
+    FILE **arquivos;
+    int quantidade;
+    int capacidade;
+} ListaCorridas;
+
+static int adicionarCorrida(ListaCorridas *lista, FILE *arquivo) {
+    if (lista->quantidade == lista->capacidade) {
+        int nova = lista->capacidade > 0 ? lista->capacidade * 2 : 16;
+        FILE **novos = (FILE**) realloc(lista->arquivos, (size_t) nova * sizeof(FILE*));
+        if (novos == NULL) {
+            return 0;
+        }
+        lista->arquivos = novos;
+        lista->capacidade = nova;
+    }
+    lista->arquivos[lista->quantidade++] = arquivo;
+    return 1;
+}
+
+static void liberarCorridas(ListaCorridas *lista) {
+    for (int i = 0; i < lista->quantidade; i++) {
+        if (lista->arquivos[i] != NULL) {
+            fclose(lista->arquivos[i]);
+        }
+    }
+    free(lista->arquivos);
+    lista->arquivos = NULL;
+    lista->quantidade = 0;
+    lista->capacidade = 0;
+}
+
+/**
+ * @brief Gera as corridas iniciais por seleção por substituição.
+ *
+ * array[0..tamanho) é a Min-Heap da corrida atual e array[tamanho..tamanho+proximos)
+ * guarda os pacientes que chegaram com prioridade menor que a última gravada e
+ * por isso pertencem à próxima corrida. Quando a heap esvazia, a corrida é
+ * fechada e os pacientes guardados formam a heap seguinte.
+ */
+static int gerarCorridas(LeitorPacientes *entrada, Paciente array[], int capacidade, size_t bufferSaida,
+                         ListaCorridas *corridas, long long *registros) {
+    int tamanho = 0;
+    int proximos = 0;
+    Paciente p;
+    while (tamanho < capacidade && lerPaciente(entrada, &p)) {
+        array[tamanho++] = p;
+    }
+    if (entrada->erro) {
+        return HEAP_ERRO_ARQUIVO;
+    }
+    *registros = tamanho;
+    int haEntrada = tamanho == capacidade;
+    externaMinConstruir(array, tamanho);
+
+    EscritorPacientes escritor;
+    if (!iniciarEscritor(&escritor, NULL, bufferSaida)) {
+        return HEAP_ERRO_MEMORIA;
+    }
+    int status = HEAP_OK;
+    while (tamanho > 0 && status == HEAP_OK) {
+        escritor.arquivo = tmpfile();
+        if (escritor.arquivo == NULL || !adicionarCorrida(corridas, escritor.arquivo)) {
+            if (escritor.arquivo != NULL) fclose(escritor.arquivo);
+            status = escritor.arquivo == NULL ? HEAP_ERRO_ARQUIVO : HEAP_ERRO_MEMORIA;
+            break;
+        }
+
+        while (tamanho > 0) {
+            Paciente menor = array[0];
+            escreverPaciente(&escritor, menor);
+            if (haEntrada && lerPaciente(entrada, &p)) {
+                (*registros)++;
+                if (p.prioridade >= menor.prioridade) {
+                    externaMinDescerValor(array, tamanho, 0, p); // Continua na corrida atual
+                } else {
+                    // Encolhe a heap e guarda p na primeira posição liberada
+                    Paciente ultimo = array[--tamanho];
+                    array[tamanho] = p;
+                    proximos++;
+                    if (tamanho > 0) {
+                        externaMinDescerValor(array, tamanho, 0, ultimo);
+                    }
+                }
+            } else {
+                haEntrada = 0;
+                Paciente ultimo = array[--tamanho];
+                // Mantém a região dos guardados contígua logo após a heap
+                array[tamanho] = array[tamanho + proximos];
+                if (tamanho > 0) {
+                    externaMinDescerValor(array, tamanho, 0, ultimo);
+                }
+            }
+        }
+        if (entrada->erro) {
+            status = HEAP_ERRO_ARQUIVO;
+            break;
+        }
+
+        descarregarEscritor(&escritor);
+        if (escritor.erro || fflush(escritor.arquivo) != 0) {
+            status = HEAP_ERRO_ARQUIVO;
+            break;
+        }
+        tamanho = proximos;
+        proximos = 0;
+        externaMinConstruir(array, tamanho);
+    }
+    free(escritor.buffer);
+    return status;
+}
+
+/**
+ * @brief Intercala 'k' corridas em 'destino' com uma MinHeap como fronteira:
+ * cada entrada é {id = índice da corrida, prioridade = cabeça da corrida}.
+ */
+static int intercalarCorridas(FILE *origens[], int k, FILE *destino, size_t bufferCorrida, size_t bufferSaida) {
+    LeitorPacientes *leitores = (LeitorPacientes*) calloc((size_t) k, sizeof(LeitorPacientes));
+    Paciente *cabecas = (Paciente*) malloc((size_t) k * sizeof(Paciente));
+    MinHeap *fronteira = criarMinHeap(k);
+    EscritorPacientes escritor = {0};
+    int status = HEAP_OK;
+    if (leitores == NULL || cabecas == NULL || fronteira == NULL ||
+        !iniciarEscritor(&escritor, destino, bufferSaida)) {
+        status = HEAP_ERRO_MEMORIA;
+    }
+
+    for (int i = 0; i < k && status == HEAP_OK; i++) {
+        rewind(origens[i]);
+        if (!iniciarLeitor(&leitores[i], origens[i], bufferCorrida)) {
+            status = HEAP_ERRO_MEMORIA;
+        } else if (lerPaciente(&leitores[i], &cabecas[i])) {
+            inserirPacienteMin(fronteira, (Paciente){i, cabecas[i].prioridade});
+        }
+    }
+
+    while (status == HEAP_OK && !minHeapVazia(fronteira)) {
+        int i = extrairMinPacienteHeap(fronteira).id;
+        escreverPaciente(&escritor, cabecas[i]);
+        if (lerPaciente(&leitores[i], &cabecas[i])) {
+            inserirPacienteMin(fronteira, (Paciente){i, cabecas[i].prioridade});
+        }
+    }
+
+    if (status == HEAP_OK) {
+        for (int i = 0; i < k; i++) {
+            if (leitores[i].erro) status = HEAP_ERRO_ARQUIVO;
+        }
+        descarregarEscritor(&escritor);
+        if (escritor.erro || fflush(destino) != 0) status = HEAP_ERRO_ARQUIVO;
+    }
+
+    if (leitores != NULL) {
+        for (int i = 0; i < k; i++) free(leitores[i].buffer);
+    }
+    free(leitores);
+    free(cabecas);
+    free(escritor.buffer);
+    liberarMinHeap(fronteira);
+    return status;
+}
+
+int ordenarArquivoPacientes(const char *caminhoEntrada, const char *caminhoSaida, size_t memoria,
+                            EstatisticasOrdenacaoExterna *estatisticas) {
+    if (caminhoEntrada == NULL || caminhoSaida == NULL) {
+        return HEAP_ERRO_PARAMETRO;
+    }
+    if (memoria < ORDENACAO_EXTERNA_MEMORIA_MINIMA) {
+        memoria = ORDENACAO_EXTERNA_MEMORIA_MINIMA;
+    }
+
+    // Geração: metade para a heap, um quarto para cada buffer de E/S
+    size_t registrosHeap = (memoria / 2) / sizeof(Paciente);
+    if (registrosHeap > (size_t) (1 << 30)) {
+        registrosHeap = (size_t) 1 << 30; // Índices da heap são int
+    }
+    size_t registrosBuffer = (memoria / 4) / sizeof(Paciente);
+
+    // Intercalação: um quarto para a saída, o resto dividido entre as vias
+    int vias = (int) ((memoria - memoria / 4) / BUFFER_CORRIDA_MINIMO);
+    if (vias > ORDENACAO_EXTERNA_MAX_VIAS) vias = ORDENACAO_EXTERNA_MAX_VIAS;
+    if (vias < 2) vias = 2;
+
+    FILE *entrada = fopen(caminhoEntrada, "rb");
+    if (entrada == NULL) {
+        return HEAP_ERRO_ARQUIVO;
+    }
+    Paciente *array = (Paciente*) malloc(registrosHeap * sizeof(Paciente));
+    LeitorPacientes leitor;
+    if (array == NULL || !iniciarLeitor(&leitor, entrada, registrosBuffer)) {
+        free(array);
+        fclose(entrada);
+        return HEAP_ERRO_MEMORIA;
+    }
+
+    ListaCorridas corridas = {NULL, 0, 0};
+    long long registros = 0;
+    int status = gerarCorridas(&leitor, array, (int) registrosHeap, registrosBuffer, &corridas, &registros);
+    free(array);
+    free(leitor.buffer);
+    fclose(entrada);
+    int corridasIniciais = corridas.quantidade;
+    int passadas = 0;
+
+    // Passadas intermediárias até restarem no máximo 'vias' corridas
+    while (status == HEAP_OK && corridas.quantidade > vias) {
+        ListaCorridas seguintes = {NULL, 0, 0};
+        int k = corridas.quantidade / vias + (corridas.quantidade % vias != 0); // grupos
+        for (int g = 0; g < k && status == HEAP_OK; g++) {
+            int inicio = g * vias;
+            int fim = inicio + vias < corridas.quantidade ? inicio + vias : corridas.quantidade;
+            FILE *destino = tmpfile();
+            if (destino == NULL) {
+                status = HEAP_ERRO_ARQUIVO;
+            } else if (!adicionarCorrida(&seguintes, destino)) {
+                fclose(destino);
+                status = HEAP_ERRO_MEMORIA;
+            } else {
+                size_t bufferCorrida = (memoria - memoria / 4) / (size_t) (fim - inicio) / sizeof(Paciente);
+                status = intercalarCorridas(corridas.arquivos + inicio, fim - inicio, destino,
+                                            bufferCorrida, registrosBuffer);
+            }
+        }
+        liberarCorridas(&corridas);
+        corridas = seguintes;
+        passadas++;
+    }
+
+    if (status == HEAP_OK) {
+        FILE *saida = fopen(caminhoSaida, "wb");
+        if (saida == NULL) {
+            status = HEAP_ERRO_ARQUIVO;
+        } else {
+            if (corridas.quantidade > 0) {
+                size_t bufferCorrida = (memoria - memoria / 4) / (size_t) corridas.quantidade / sizeof(Paciente);
+                status = intercalarCorridas(corridas.arquivos, corridas.quantidade, saida,
+                                            bufferCorrida, registrosBuffer);
+                passadas++;
+            }
+            if (fclose(saida) != 0 && status == HEAP_OK) {
+                status = HEAP_ERRO_ARQUIVO;
+            }
+        }
+    }
+    liberarCorridas(&corridas);
+
+    if (estatisticas != NULL) {
+        estatisticas->registros = registros;
+        estatisticas->corridas = corridasIniciais;
+        estatisticas->passadas = passadas;
+    }
+    return status;
+}
@@ -0,0 +1,43 @@
+#ifndef ORDENACAO_EXTERNA_H
+#define ORDENACAO_EXTERNA_H
+
+#include <stddef.h> // size_t
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Menor orçamento de memória aceito (valores menores são elevados a este)
+#define ORDENACAO_EXTERNA_MEMORIA_MINIMA ((size_t) 1 << 20)
+
+// Número máximo de corridas intercaladas por passada (limita arquivos abertos)
+#define ORDENACAO_EXTERNA_MAX_VIAS 256
+
+// Estatísticas de uma ordenação externa
+typedef struct {
+    long long registros; // Pacientes lidos (e gravados)
+    int corridas;        // Corridas geradas pela seleção por substituição
+    int passadas;        // Passadas de intercalação (inclui a final)
+} EstatisticasOrdenacaoExterna;
+
+/**
+ * @brief Ordena um arquivo binário de Pacientes (registros Paciente contíguos,
+ * na representação nativa) em ordem ascendente de prioridade, usando no máximo
+ * aproximadamente 'memoria' bytes de RAM.
+ *
+ * As corridas iniciais são geradas por seleção por substituição sobre uma
+ * MinHeap (em média, com o dobro do tamanho da memória para entradas
+ * aleatórias) e gravadas em arquivos temporários (tmpfile). Em seguida são
+ * intercaladas (k-way merge) com outra MinHeap como fronteira, com buffers de
+ * leitura e escrita grandes e sequenciais; se houver mais de
+ * ORDENACAO_EXTERNA_MAX_VIAS corridas, são feitas passadas intermediárias.
+ *
+ * @param caminhoEntrada Arquivo de entrada.
+ * @param caminhoSaida Arquivo de saída (sobrescrito).
+ * @param memoria Orçamento de memória em bytes.
+ * @param estatisticas Se não for NULL, recebe contagens da execução.
+ * @return HEAP_OK, HEAP_ERRO_ARQUIVO (também se o tamanho da entrada não for
+ * múltiplo de sizeof(Paciente)), HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int ordenarArquivoPacientes(const char *caminhoEntrada, const char *caminhoSaida, size_t memoria,
+                            EstatisticasOrdenacaoExterna *estatisticas);
+
+#endif // ORDENACAO_EXTERNA_H
@@ -0,0 +1,130 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE // mremap e MAP_HUGETLB
+#endif
+#include "paginas_grandes.h"
+#include <stdint.h> // uintptr_t, SIZE_MAX
+#include <stdlib.h> // Para malloc, realloc, free
+#include <string.h> // memcpy
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#define PAGINAS_MMAP 1
+#endif
+
+#ifdef PAGINAS_MMAP
+/**
+ * @brief Arredonda 'bytes' para um múltiplo de PAGINA_GRANDE_BYTES (0 se transbordar).
+ */
+static size_t arredondarPaginaGrande(size_t bytes) {
+    if (bytes > SIZE_MAX - (PAGINA_GRANDE_BYTES - 1)) return 0;
+    return (bytes + PAGINA_GRANDE_BYTES - 1) & ~(PAGINA_GRANDE_BYTES - 1);
+}
+
+/**
+ * @brief Mapeamento anônimo de 'bytes' (múltiplo de PAGINA_GRANDE_BYTES) com
+ * início alinhado a PAGINA_GRANDE_BYTES: mapeia uma página grande a mais e
+ * devolve as sobras das pontas. Sem alinhamento, o kernel não consegue usar
+ * páginas transparentes nas pontas do array.
+ */
+static void* mapearAlinhado(size_t bytes) {
+    if (bytes > SIZE_MAX - PAGINA_GRANDE_BYTES) return NULL;
+    size_t total = bytes + PAGINA_GRANDE_BYTES;
+    char *bruto = (char*) mmap(NULL, total, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (bruto == (char*) MAP_FAILED) return NULL;
+    uintptr_t inicio = ((uintptr_t) bruto + PAGINA_GRANDE_BYTES - 1) & ~(uintptr_t) (PAGINA_GRANDE_BYTES - 1);
+    size_t antes = (size_t) (inicio - (uintptr_t) bruto);
+    if (antes > 0) {
+        munmap(bruto, antes);
+    }
+    if (total - antes > bytes) {
+        munmap((char*) inicio + bytes, total - antes - bytes);
+    }
+    return (void*) inicio;
+}
+
+/**
+ * @brief Mapeia 'bytes' (já arredondados) no modo pedido.
+ */
+static void* mapearPaginas(size_t bytes, ModoPaginas modo) {
+#ifdef MAP_HUGETLB
+    if (modo == PAGINAS_EXPLICITAS) {
+        void *mapa = mmap(NULL, bytes, PROT_READ | PROT_WRITE,
+                          MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (mapa != MAP_FAILED) return mapa;
+        // Sem páginas reservadas: páginas transparentes
+    }
+#else
+    (void) modo;
+#endif
+    void *mapa = mapearAlinhado(bytes);
+#ifdef MADV_HUGEPAGE
+    if (mapa != NULL) {
+        madvise(mapa, bytes, MADV_HUGEPAGE); // Só um pedido: falhar aqui não é erro
+    }
+#endif
+    return mapa;
+}
+#endif
+
+void* realocarPaginas(void *atual, size_t bytesAtuais, size_t bytes, ModoPaginas modo) {
+#ifdef PAGINAS_MMAP
+    if (modo != PAGINAS_NORMAIS) {
+        if (bytes == 0) {
+            liberarPaginas(atual, bytesAtuais, modo);
+            return NULL;
+        }
+        size_t novo = arredondarPaginaGrande(bytes);
+        if (novo == 0) return NULL;
+        if (atual == NULL) return mapearPaginas(novo, modo);
+        size_t antigo = arredondarPaginaGrande(bytesAtuais);
+        if (novo == antigo) return atual;
+        if (novo < antigo) {
+            munmap((char*) atual + novo, antigo - novo);
+            return atual;
+        }
+#ifdef MREMAP_MAYMOVE
+        // Move as páginas em vez de copiar; em caso de falha nada muda
+        void *movido = mremap(atual, antigo, novo, MREMAP_MAYMOVE);
+        if (movido != MAP_FAILED) {
+#ifdef MADV_HUGEPAGE
+            madvise(movido, novo, MADV_HUGEPAGE);
+#endif
+            return movido;
+        }
+#endif
+        void *copia = mapearPaginas(novo, modo);
+        if (copia == NULL) return NULL;
+        memcpy(copia, atual, bytesAtuais < bytes ? bytesAtuais : bytes);
+        munmap(atual, antigo);
+        return copia;
+    }
+#endif
+    (void) bytesAtuais;
+    (void) modo;
+    if (bytes == 0) {
+        free(atual);
+        return NULL;
+    }
+    return realloc(atual, bytes);
+}
+
+void liberarPaginas(void *array, size_t bytes, ModoPaginas modo) {
+    if (array == NULL) return;
+#ifdef PAGINAS_MMAP
+    if (modo != PAGINAS_NORMAIS) {
+        munmap(array, arredondarPaginaGrande(bytes));
+        return;
+    }
+#endif
+    (void) bytes;
+    (void) modo;
+    free(array);
+}
+
+const char* nomeModoPaginas(ModoPaginas modo) {
+    switch (modo) {
+        case PAGINAS_TRANSPARENTES: return "transparentes";
+        case PAGINAS_EXPLICITAS: return "explicitas";
+        default: return "normais";
+    }
+}
@@ -0,0 +1,52 @@
+#ifndef PAGINAS_GRANDES_H
+#define PAGINAS_GRANDES_H
+
+#include <stddef.h> // size_t
+
+// Alocação de arrays grandes apoiados em páginas grandes (2 MiB em x86-64).
+// Com páginas de 4 KiB, uma heap de bilhões de pacientes toca uma página nova
+// quase a cada nível descido depois dos primeiros e as falhas de TLB passam a
+// dominar o custo do heapify; com páginas de 2 MiB a mesma descida cobre 512
+// vezes mais memória por entrada de TLB.
+//
+// Em sistemas sem mmap (ex.: Windows), todos os modos recaem em malloc.
+
+// Tamanho de página grande assumido para alinhamento e arredondamento
+#define PAGINA_GRANDE_BYTES ((size_t) 2 * 1024 * 1024)
+
+// Como o array é alocado
+typedef enum {
+    PAGINAS_NORMAIS = 0,   // malloc/realloc
+    PAGINAS_TRANSPARENTES, // mmap alinhado a 2 MiB + madvise(MADV_HUGEPAGE) (THP do Linux)
+    PAGINAS_EXPLICITAS     // mmap com MAP_HUGETLB (páginas reservadas em /proc/sys/vm/nr_hugepages);
+                           // sem páginas reservadas, recai em PAGINAS_TRANSPARENTES
+} ModoPaginas;
+
+/**
+ * @brief Aloca, realoca ou libera um array no modo de páginas escolhido, com a
+ * semântica de realloc: 'atual' NULL aloca; 'bytes' 0 libera e retorna NULL.
+ * O conteúdo é preservado até o menor dos dois tamanhos. Em PAGINAS_NORMAIS é
+ * exatamente realloc; nos outros modos o mapeamento é arredondado para
+ * múltiplos de PAGINA_GRANDE_BYTES e cresce com mremap quando disponível.
+ * @param atual Array atual (NULL se ainda não houver).
+ * @param bytesAtuais Bytes pedidos na alocação de 'atual' (ignorado se NULL).
+ * @param bytes Novo tamanho em bytes.
+ * @param modo O mesmo modo usado para alocar 'atual'.
+ * @return O array, ou NULL em caso de falha (quando 'bytes' > 0, 'atual' é mantido).
+ */
+void* realocarPaginas(void *atual, size_t bytesAtuais, size_t bytes, ModoPaginas modo);
+
+/**
+ * @brief Libera um array alocado com realocarPaginas.
+ * @param array O array (pode ser NULL).
+ * @param bytes Bytes pedidos na última (re)alocação.
+ * @param modo O modo usado na alocação.
+ */
+void liberarPaginas(void *array, size_t bytes, ModoPaginas modo);
+
+/**
+ * @brief Nome legível do modo de páginas.
+ */
+const char* nomeModoPaginas(ModoPaginas modo);
+
+#endif // PAGINAS_GRANDES_H
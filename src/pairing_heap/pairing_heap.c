@@ -0,0 +1,178 @@
+#include "pairing_heap.h"
+
+// Funções auxiliares estáticas
+
+/**
+ * @brief Tira um nó do pool: primeiro da lista de livres, depois do bloco atual.
+ * @return O nó, ou NULL se um novo bloco não pôde ser alocado.
+ */
+static NoPairing* alocarNo(PairingHeap *heap) {
+    if (heap->livres != NULL) {
+        NoPairing *no = heap->livres;
+        heap->livres = no->irmao;
+        if (heap->livres == NULL) {
+            heap->ultimoLivre = NULL;
+        }
+        return no;
+    }
+    if (heap->blocos == NULL || heap->usadosBloco == PAIRING_NOS_POR_BLOCO) {
+        BlocoPairing *bloco = (BlocoPairing*) malloc(sizeof(BlocoPairing));
+        if (bloco == NULL) {
+            return NULL;
+        }
+        bloco->proximo = heap->blocos;
+        if (heap->blocos == NULL) {
+            heap->ultimoBloco = bloco;
+        }
+        heap->blocos = bloco;
+        heap->usadosBloco = 0;
+    }
+    return &heap->blocos->nos[heap->usadosBloco++];
+}
+
+static void devolverNo(PairingHeap *heap, NoPairing *no) {
+    no->irmao = heap->livres;
+    if (heap->livres == NULL) {
+        heap->ultimoLivre = no;
+    }
+    heap->livres = no;
+}
+
+/**
+ * @brief Liga duas raízes: a de menor prioridade vira o primeiro filho da outra.
+ */
+static NoPairing* ligar(NoPairing *a, NoPairing *b) {
+    if (a == NULL) return b;
+    if (b == NULL) return a;
+    if (b->paciente.prioridade > a->paciente.prioridade) {
+        NoPairing *temp = a;
+        a = b;
+        b = temp;
+    }
+    b->irmao = a->filho;
+    a->filho = b;
+    return a;
+}
+
+/**
+ * @brief Pareamento em duas passadas: liga os filhos dois a dois da esquerda
+ * para a direita e depois acumula os pares da direita para a esquerda.
+ */
+static NoPairing* parearFilhos(NoPairing *primeiro) {
+    NoPairing *pares = NULL; // Pares em ordem inversa, encadeados por 'irmao'
+    while (primeiro != NULL) {
+        NoPairing *a = primeiro;
+        NoPairing *b = a->irmao;
+        if (b == NULL) {
+            a->irmao = pares;
+            pares = a;
+            break;
+        }
+        primeiro = b->irmao;
+        a->irmao = NULL;
+        b->irmao = NULL;
+        NoPairing *par = ligar(a, b);
+        par->irmao = pares;
+        pares = par;
+    }
+
+    NoPairing *raiz = NULL;
+    while (pares != NULL) {
+        NoPairing *proximo = pares->irmao;
+        pares->irmao = NULL;
+        raiz = ligar(raiz, pares);
+        pares = proximo;
+    }
+    return raiz;
+}
+
+PairingHeap* criarPairingHeap(void) {
+    PairingHeap *heap = (PairingHeap*) calloc(1, sizeof(PairingHeap));
+    if (heap == NULL) {
+        perror("Falha ao alocar memória para heap (PairingHeap)");
+        return NULL;
+    }
+    return heap;
+}
+
+int inserirPacientePairing(PairingHeap *heap, Paciente p) {
+    if (heap == NULL) return HEAP_ERRO_PARAMETRO;
+    NoPairing *no = alocarNo(heap);
+    if (no == NULL) return HEAP_ERRO_MEMORIA;
+    no->paciente = p;
+    no->filho = NULL;
+    no->irmao = NULL;
+    heap->raiz = ligar(heap->raiz, no);
+    heap->tamanho++;
+    return HEAP_OK;
+}
+
+Paciente extrairMaxPacientePairing(PairingHeap *heap) {
+    Paciente pVazio = {-1, -1};
+    if (heap == NULL || heap->raiz == NULL) {
+        return pVazio;
+    }
+    NoPairing *raiz = heap->raiz;
+    heap->raiz = parearFilhos(raiz->filho);
+    heap->tamanho--;
+    Paciente p = raiz->paciente;
+    devolverNo(heap, raiz);
+    return p;
+}
+
+int fundirPairingHeaps(PairingHeap *destino, PairingHeap *origem) {
+    if (destino == NULL || origem == NULL || destino == origem) return HEAP_ERRO_PARAMETRO;
+    destino->raiz = ligar(destino->raiz, origem->raiz);
+    destino->tamanho += origem->tamanho;
+
+    // Os blocos de 'origem' entram depois do primeiro bloco de 'destino',
+    // que continua sendo o bloco atual (o resto não entregue do bloco atual
+    // de 'origem' fica ocioso até a liberação)
+    if (origem->blocos != NULL) {
+        if (destino->blocos == NULL) {
+            destino->blocos = origem->blocos;
+            destino->ultimoBloco = origem->ultimoBloco;
+            destino->usadosBloco = origem->usadosBloco;
+        } else {
+            origem->ultimoBloco->proximo = destino->blocos->proximo;
+            if (destino->blocos->proximo == NULL) {
+                destino->ultimoBloco = origem->ultimoBloco;
+            }
+            destino->blocos->proximo = origem->blocos;
+        }
+    }
+    if (origem->livres != NULL) {
+        if (destino->livres == NULL) {
+            destino->livres = origem->livres;
+        } else {
+            destino->ultimoLivre->irmao = origem->livres;
+        }
+        destino->ultimoLivre = origem->ultimoLivre;
+    }
+
+    origem->raiz = NULL;
+    origem->tamanho = 0;
+    origem->blocos = NULL;
+    origem->ultimoBloco = NULL;
+    origem->usadosBloco = 0;
+    origem->livres = NULL;
+    origem->ultimoLivre = NULL;
+    return HEAP_OK;
+}
+
+int pairingHeapVazia(PairingHeap *heap) {
+    if (heap == NULL) return 1;
+    return heap->raiz == NULL;
+}
+
+void liberarPairingHeap(PairingHeap *heap) {
+    if (heap != NULL) {
+        BlocoPairing *bloco = heap->blocos;
+        while (bloco != NULL) {
+            BlocoPairing *proximo = bloco->proximo;
+            free(bloco);
+            bloco = proximo;
+        }
+        free(heap);
+    }
+}
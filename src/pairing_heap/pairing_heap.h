@@ -0,0 +1,83 @@
+#ifndef PAIRING_HEAP_H
+#define PAIRING_HEAP_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Nós alocados por bloco do pool
+#define PAIRING_NOS_POR_BLOCO 1024
+
+// Nó da pairing heap (representação filho-irmão)
+typedef struct NoPairing {
+    Paciente paciente;
+    struct NoPairing *filho; // Primeiro filho
+    struct NoPairing *irmao; // Próximo irmão (ou próximo nó livre no pool)
+} NoPairing;
+
+// Bloco de nós do pool
+typedef struct BlocoPairing {
+    struct BlocoPairing *proximo;
+    NoPairing nos[PAIRING_NOS_POR_BLOCO];
+} BlocoPairing;
+
+// Max-Heap fundível (pairing heap) com nós tirados de um pool de blocos.
+// Inserção e fusão custam O(1); extração custa O(log n) amortizado.
+typedef struct {
+    NoPairing *raiz;
+    int tamanho;
+    BlocoPairing *blocos;      // Blocos alocados (liberados juntos)
+    BlocoPairing *ultimoBloco; // Para emendar listas de blocos em O(1)
+    int usadosBloco;           // Nós já entregues do primeiro bloco
+    NoPairing *livres;         // Nós devolvidos, reaproveitados antes de novos
+    NoPairing *ultimoLivre;    // Para emendar listas de livres em O(1)
+} PairingHeap;
+
+/**
+ * @brief Cria uma nova pairing heap (Max) vazia.
+ * @return Ponteiro para a PairingHeap criada, ou NULL em caso de falha.
+ */
+PairingHeap* criarPairingHeap(void);
+
+/**
+ * @brief Insere um paciente em O(1).
+ * @param heap Ponteiro para a PairingHeap.
+ * @param p O Paciente a ser inserido.
+ * @return HEAP_OK, HEAP_ERRO_MEMORIA ou HEAP_ERRO_PARAMETRO.
+ */
+int inserirPacientePairing(PairingHeap *heap, Paciente p);
+
+/**
+ * @brief Extrai o paciente de maior prioridade em O(log n) amortizado
+ * (pareamento em duas passadas dos filhos da raiz).
+ * @param heap Ponteiro para a PairingHeap.
+ * @return O Paciente extraído. Se a heap estiver vazia, retorna um Paciente
+ * com id e prioridade -1.
+ */
+Paciente extrairMaxPacientePairing(PairingHeap *heap);
+
+/**
+ * @brief Funde 'origem' em 'destino' em O(1): as raízes são ligadas e os
+ * blocos de nós de 'origem' passam a pertencer a 'destino'. 'origem' fica
+ * vazia e continua utilizável (e deve ser liberada normalmente).
+ * @param destino Ponteiro para a PairingHeap que recebe os pacientes.
+ * @param origem Ponteiro para a PairingHeap esvaziada.
+ * @return HEAP_OK ou HEAP_ERRO_PARAMETRO.
+ */
+int fundirPairingHeaps(PairingHeap *destino, PairingHeap *origem);
+
+/**
+ * @brief Verifica se a pairing heap está vazia.
+ * @param heap Ponteiro para a PairingHeap.
+ * @return 1 se a heap estiver vazia, 0 caso contrário.
+ */
+int pairingHeapVazia(PairingHeap *heap);
+
+/**
+ * @brief Libera a pairing heap e todos os seus blocos de nós.
+ * @param heap Ponteiro para a PairingHeap a ser liberada.
+ */
+void liberarPairingHeap(PairingHeap *heap);
+
+#endif // PAIRING_HEAP_H
@@ -0,0 +1,389 @@
+#include "replay.h"
+#include "max_heap/max_heap.h"
+#include "dary_heap/dary_heap.h"
+#include "indexed_heap/indexed_heap.h"
+#include "pairing_heap/pairing_heap.h"
+#include "fila_baldes/fila_baldes.h"
+#include "heap_min_max/heap_min_max.h"
+#include <limits.h> // INT_MAX
+#include <string.h> // memset, strcmp
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+static const char *nomesBackend[REPLAY_QUANTIDADE] = {
+    "max_heap", "dary_heap", "indexed_heap", "pairing_heap", "fila_baldes", "heap_min_max"
+};
+
+static const char *nomesOperacao[REPLAY_OP_QUANTIDADE] = {"chegada", "extrair", "repriorizar", "remover"};
+
+// Relógio monotônico em ns
+static double agoraNs(void) {
+#ifdef _WIN32
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER t;
+    if (freq.QuadPart == 0) {
+        QueryPerformanceFrequency(&freq);
+    }
+    QueryPerformanceCounter(&t);
+    return (double) t.QuadPart * 1e9 / (double) freq.QuadPart;
+#else
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (double) t.tv_sec * 1e9 + (double) t.tv_nsec;
+#endif
+}
+
+// Faixa do histograma log-linear para 'ns' (valores abaixo de 16 têm faixa própria)
+static int faixaLatencia(unsigned long long ns) {
+    if (ns < REPLAY_SUBFAIXAS) {
+        return (int) ns;
+    }
+    int expoente = 63;
+    while (!(ns >> expoente)) {
+        expoente--;
+    }
+    int sub = (int) ((ns >> (expoente - 4)) & (REPLAY_SUBFAIXAS - 1));
+    return REPLAY_SUBFAIXAS + (expoente - 4) * REPLAY_SUBFAIXAS + sub;
+}
+
+// Meio da faixa f, em ns
+static double valorFaixa(int f) {
+    if (f < REPLAY_SUBFAIXAS) {
+        return f;
+    }
+    int expoente = (f - REPLAY_SUBFAIXAS) / REPLAY_SUBFAIXAS + 4;
+    int sub = (f - REPLAY_SUBFAIXAS) % REPLAY_SUBFAIXAS;
+    double largura = (double) (1ULL << (expoente - 4));
+    return ((double) (REPLAY_SUBFAIXAS + sub) + 0.5) * largura;
+}
+
+// Fila em uso e, para as filas sem acesso por id, o estado da invalidação
+// preguiçosa. Cada entrada inserida leva no campo id uma ficha própria em vez
+// do id do paciente, e só a ficha registrada em fichaAtual[id] é válida: uma
+// entrada antiga nunca se passa pela atual, mesmo com a mesma prioridade.
+typedef struct {
+    BackendReplay backend;
+    MaxHeap *maxHeap;
+    DaryHeap *dary;
+    IndexedHeap *indexada;
+    PairingHeap *pairing;
+    FilaBaldes *baldes;
+    HeapMinMax *minMax;
+    int *prioridadeAtual;
+    int *fichaAtual;     // Por id: ficha da entrada válida, -1 se não está esperando
+    int *idDaFicha;      // Por ficha: id do paciente
+    int *fichasLivres;   // Pilha de fichas devolvidas
+    int livres;
+    int fichasUsadas;    // Fichas já criadas (todas abaixo deste valor)
+    int capacidadeFichas;
+    long long tamanho;
+} FilaReplay;
+
+static int criarFilaReplay(FilaReplay *f, BackendReplay backend, CabecalhoTrace cab) {
+    memset(f, 0, sizeof(*f));
+    f->backend = backend;
+    int criada;
+    switch (backend) {
+        case REPLAY_MAX_HEAP:     criada = (f->maxHeap = criarMaxHeapExpansivel(0)) != NULL; break;
+        case REPLAY_DARY_HEAP:    criada = (f->dary = criarDaryHeapExpansivel(0)) != NULL; break;
+        case REPLAY_INDEXED_HEAP: criada = (f->indexada = criarIndexedHeap(cab.idMaximo)) != NULL; break;
+        case REPLAY_PAIRING_HEAP: criada = (f->pairing = criarPairingHeap()) != NULL; break;
+        case REPLAY_FILA_BALDES:  criada = (f->baldes = criarFilaBaldes(0, cab.prioridadeMaxima)) != NULL; break;
+        default:                  criada = (f->minMax = criarHeapMinMaxExpansivel(0)) != NULL; break;
+    }
+    if (!criada) {
+        return HEAP_ERRO_MEMORIA;
+    }
+    if (backend != REPLAY_INDEXED_HEAP) {
+        size_t ids = (size_t) cab.idMaximo + 1;
+        f->prioridadeAtual = (int*) malloc(ids * sizeof(int));
+        f->fichaAtual = (int*) malloc(ids * sizeof(int));
+        if (f->prioridadeAtual == NULL || f->fichaAtual == NULL) {
+            return HEAP_ERRO_MEMORIA;
+        }
+        for (size_t id = 0; id < ids; id++) {
+            f->fichaAtual[id] = -1;
+        }
+    }
+    return HEAP_OK;
+}
+
+// Reserva uma ficha para uma nova entrada de 'id'; -1 sem memória
+static int novaFicha(FilaReplay *f, int id) {
+    int ficha;
+    if (f->livres > 0) {
+        ficha = f->fichasLivres[--f->livres];
+    } else {
+        if (f->fichasUsadas == f->capacidadeFichas) {
+            if (f->capacidadeFichas > INT_MAX / 2) {
+                return -1;
+            }
+            int nova = f->capacidadeFichas > 0 ? f->capacidadeFichas * 2 : 1024;
+            int *ids = (int*) realloc(f->idDaFicha, (size_t) nova * sizeof(int));
+            if (ids == NULL) {
+                return -1;
+            }
+            f->idDaFicha = ids;
+            int *livres = (int*) realloc(f->fichasLivres, (size_t) nova * sizeof(int));
+            if (livres == NULL) {
+                return -1;
+            }
+            f->fichasLivres = livres;
+            f->capacidadeFichas = nova;
+        }
+        ficha = f->fichasUsadas++;
+    }
+    f->idDaFicha[ficha] = id;
+    return ficha;
+}
+
+static void devolverFicha(FilaReplay *f, int ficha) {
+    f->fichasLivres[f->livres++] = ficha;
+}
+
+static void liberarFilaReplay(FilaReplay *f) {
+    liberarMaxHeap(f->maxHeap);
+    liberarDaryHeap(f->dary);
+    liberarIndexedHeap(f->indexada);
+    liberarPairingHeap(f->pairing);
+    liberarFilaBaldes(f->baldes);
+    liberarHeapMinMax(f->minMax);
+    free(f->prioridadeAtual);
+    free(f->fichaAtual);
+    free(f->idDaFicha);
+    free(f->fichasLivres);
+}
+
+static int inserirFilaReplay(FilaReplay *f, Paciente p) {
+    switch (f->backend) {
+        case REPLAY_MAX_HEAP:     return inserirPacienteMax(f->maxHeap, p);
+        case REPLAY_DARY_HEAP:    return inserirPacienteDary(f->dary, p);
+        case REPLAY_INDEXED_HEAP: return inserirPacienteIndexed(f->indexada, p);
+        case REPLAY_PAIRING_HEAP: return inserirPacientePairing(f->pairing, p);
+        case REPLAY_FILA_BALDES:  return inserirPacienteBaldes(f->baldes, p);
+        default:                  return inserirPacienteMinMax(f->minMax, p);
+    }
+}
+
+static Paciente extrairFilaReplay(FilaReplay *f) {
+    switch (f->backend) {
+        case REPLAY_MAX_HEAP:     return extrairMaxPacienteHeap(f->maxHeap);
+        case REPLAY_DARY_HEAP:    return extrairMaxPacienteDary(f->dary);
+        case REPLAY_INDEXED_HEAP: return extrairMaxPacienteIndexed(f->indexada);
+        case REPLAY_PAIRING_HEAP: return extrairMaxPacientePairing(f->pairing);
+        case REPLAY_FILA_BALDES:  return extrairMaxPacienteBaldes(f->baldes);
+        default:                  return extrairMaxPacienteMinMax(f->minMax);
+    }
+}
+
+/**
+ * @brief Insere uma nova entrada de 'id' com uma ficha própria, que passa a
+ * ser a válida (nas filas com invalidação preguiçosa).
+ */
+static int inserirEntradaReplay(FilaReplay *f, int id, int prioridade) {
+    int ficha = novaFicha(f, id);
+    if (ficha < 0) {
+        return HEAP_ERRO_MEMORIA;
+    }
+    int status = inserirFilaReplay(f, (Paciente){ficha, prioridade});
+    if (status != HEAP_OK) {
+        devolverFicha(f, ficha);
+        return status;
+    }
+    f->fichaAtual[id] = ficha;
+    f->prioridadeAtual[id] = prioridade;
+    return HEAP_OK;
+}
+
+/**
+ * @brief Aplica uma operação (com id e prioridade já validados). Retorna 1 se
+ * ela teve efeito, 0 se foi ignorada e um HEAP_ERRO_* se a fila falhou.
+ */
+static int aplicarOperacao(FilaReplay *f, const OperacaoTrace *op, ResultadoReplay *r) {
+    int indexada = f->backend == REPLAY_INDEXED_HEAP;
+    int status;
+    switch (op->tipo) {
+        case TRACE_CHEGADA:
+            if (indexada) {
+                status = inserirFilaReplay(f, (Paciente){op->id, op->prioridade});
+            } else if (f->fichaAtual[op->id] >= 0) {
+                return 0;
+            } else {
+                status = inserirEntradaReplay(f, op->id, op->prioridade);
+            }
+            if (status == HEAP_ERRO_DUPLICADO) {
+                return 0;
+            }
+            if (status != HEAP_OK) {
+                return status;
+            }
+            f->tamanho++;
+            return 1;
+
+        case TRACE_EXTRAIR:
+            for (;;) {
+                Paciente p = extrairFilaReplay(f);
+                if (p.id < 0) {
+                    return 0; // Fila vazia
+                }
+                if (!indexada) {
+                    int ficha = p.id;
+                    p.id = f->idDaFicha[ficha];
+                    devolverFicha(f, ficha);
+                    if (f->fichaAtual[p.id] != ficha) {
+                        r->obsoletas++;
+                        continue;
+                    }
+                    f->fichaAtual[p.id] = -1;
+                }
+                f->tamanho--;
+                r->atendidos++;
+                r->somaAtendidos += p.prioridade;
+                return 1;
+            }
+
+        case TRACE_REPRIORIZAR:
+            if (indexada) {
+                return atualizarPrioridade(f->indexada, op->id, op->prioridade) == HEAP_OK;
+            }
+            if (f->fichaAtual[op->id] < 0) {
+                return 0;
+            }
+            if (f->prioridadeAtual[op->id] == op->prioridade) {
+                return 1;
+            }
+            status = inserirEntradaReplay(f, op->id, op->prioridade);
+            return status == HEAP_OK ? 1 : status;
+
+        default: // TRACE_REMOVER
+            if (indexada) {
+                if (removerPaciente(f->indexada, op->id) != HEAP_OK) {
+                    return 0;
+                }
+            } else if (f->fichaAtual[op->id] >= 0) {
+                f->fichaAtual[op->id] = -1;
+            } else {
+                return 0;
+            }
+            f->tamanho--;
+            return 1;
+    }
+}
+
+const char* nomeBackendReplay(BackendReplay backend) {
+    return backend >= 0 && backend < REPLAY_QUANTIDADE ? nomesBackend[backend] : "?";
+}
+
+int backendReplayPorNome(const char *nome, BackendReplay *backend) {
+    for (int b = 0; b < REPLAY_QUANTIDADE; b++) {
+        if (nome != NULL && strcmp(nome, nomesBackend[b]) == 0) {
+            *backend = (BackendReplay) b;
+            return HEAP_OK;
+        }
+    }
+    return HEAP_ERRO_NAO_ENCONTRADO;
+}
+
+int executarReplay(LeitorTrace *leitor, BackendReplay backend, ResultadoReplay *resultado) {
+    if (leitor == NULL || resultado == NULL || backend < 0 || backend >= REPLAY_QUANTIDADE) {
+        return HEAP_ERRO_PARAMETRO;
+    }
+    memset(resultado, 0, sizeof(*resultado));
+    resultado->backend = backend;
+    CabecalhoTrace cab = leitor->cabecalho;
+    if (backend == REPLAY_FILA_BALDES && cab.prioridadeMaxima >= FILA_BALDES_MAX_NIVEIS) {
+        fprintf(stderr, "Faixa de prioridades grande demais para a fila por baldes\n");
+        return HEAP_ERRO_PARAMETRO;
+    }
+    FilaReplay fila;
+    int status = criarFilaReplay(&fila, backend, cab);
+    if (status != HEAP_OK) {
+        liberarFilaReplay(&fila);
+        return status;
+    }
+
+    double inicioTotal = agoraNs();
+    OperacaoTrace op;
+    int lido;
+    while ((lido = lerOperacaoTrace(leitor, &op)) == 1) {
+        int indice = op.tipo == TRACE_CHEGADA ? REPLAY_OP_CHEGADA
+                   : op.tipo == TRACE_EXTRAIR ? REPLAY_OP_EXTRAIR
+                   : op.tipo == TRACE_REPRIORIZAR ? REPLAY_OP_REPRIORIZAR : REPLAY_OP_REMOVER;
+        resultado->operacoes[indice]++;
+        if (op.tipo != TRACE_EXTRAIR &&
+            (op.id < 0 || op.id > cab.idMaximo ||
+             (op.tipo != TRACE_REMOVER && (op.prioridade < 0 || op.prioridade > cab.prioridadeMaxima)))) {
+            resultado->invalidas++;
+            continue;
+        }
+        double inicio = agoraNs();
+        int efeito = aplicarOperacao(&fila, &op, resultado);
+        double ns = agoraNs() - inicio;
+        if (efeito < 0) {
+            status = efeito;
+            break;
+        }
+        if (efeito == 0 && op.tipo != TRACE_EXTRAIR) {
+            resultado->semEfeito++;
+        }
+        resultado->nsOperacoes += ns;
+        resultado->latencia[indice][faixaLatencia(ns > 0 ? (unsigned long long) ns : 0ULL)]++;
+        if (fila.tamanho > resultado->tamanhoMaximo) {
+            resultado->tamanhoMaximo = fila.tamanho;
+        }
+    }
+    resultado->nsTotal = agoraNs() - inicioTotal;
+    liberarFilaReplay(&fila);
+    if (lido < 0) {
+        return lido;
+    }
+    return status;
+}
+
+double percentilReplay(const ResultadoReplay *resultado, int op, double q) {
+    unsigned long long total = 0;
+    for (int f = 0; f < REPLAY_FAIXAS_LATENCIA; f++) {
+        total += resultado->latencia[op][f];
+    }
+    if (total == 0) {
+        return 0.0;
+    }
+    unsigned long long alvo = (unsigned long long) (q * (double) (total - 1)) + 1;
+    unsigned long long acumulado = 0;
+    for (int f = 0; f < REPLAY_FAIXAS_LATENCIA; f++) {
+        acumulado += resultado->latencia[op][f];
+        if (acumulado >= alvo) {
+            return valorFaixa(f);
+        }
+    }
+    return valorFaixa(REPLAY_FAIXAS_LATENCIA - 1);
+}
+
+void imprimirResultadoReplay(const ResultadoReplay *resultado, FILE *saida) {
+    long long total = 0;
+    for (int op = 0; op < REPLAY_OP_QUANTIDADE; op++) {
+        total += resultado->operacoes[op];
+    }
+    fprintf(saida, "Fila: %s\n", nomeBackendReplay(resultado->backend));
+    fprintf(saida, "  Operações: %lld (inválidas: %lld, sem efeito: %lld, entradas obsoletas descartadas: %lld)\n",
+            total, resultado->invalidas, resultado->semEfeito, resultado->obsoletas);
+    fprintf(saida, "  Atendidos: %lld (soma das prioridades: %lld), maior fila: %lld\n", resultado->atendidos,
+            resultado->somaAtendidos, resultado->tamanhoMaximo);
+    fprintf(saida, "  Vazão: %.2f Mops/s nas operações, %.2f Mops/s incluindo a leitura do trace\n",
+            resultado->nsOperacoes > 0 ? total * 1e3 / resultado->nsOperacoes : 0.0,
+            resultado->nsTotal > 0 ? total * 1e3 / resultado->nsTotal : 0.0);
+    fprintf(saida, "  %-12s %12s %10s %10s %10s %10s  (ns)\n", "operacao", "quantidade", "p50", "p90", "p99",
+            "p99.9");
+    for (int op = 0; op < REPLAY_OP_QUANTIDADE; op++) {
+        if (resultado->operacoes[op] == 0) {
+            continue;
+        }
+        fprintf(saida, "  %-12s %12lld %10.0f %10.0f %10.0f %10.0f\n", nomesOperacao[op], resultado->operacoes[op],
+                percentilReplay(resultado, op, 0.50), percentilReplay(resultado, op, 0.90),
+                percentilReplay(resultado, op, 0.99), percentilReplay(resultado, op, 0.999));
+    }
+}
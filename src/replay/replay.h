@@ -0,0 +1,89 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdio.h>
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+#include "trace/trace.h" // LeitorTrace, OperacaoTrace
+
+// Replay de traces de operações (trace.h) contra uma das filas do projeto,
+// medindo vazão e a latência de cada operação. A IndexedHeap executa mudanças
+// de prioridade e remoções diretamente; as demais filas usam invalidação
+// preguiçosa (a mudança reinsere o paciente e a entrada antiga é descartada
+// quando chega à raiz), que é como elas seriam usadas em produção. Cada
+// entrada leva uma ficha única, então o descarte é exato.
+
+// Filas disponíveis para o replay
+typedef enum {
+    REPLAY_MAX_HEAP,
+    REPLAY_DARY_HEAP,
+    REPLAY_INDEXED_HEAP,
+    REPLAY_PAIRING_HEAP,
+    REPLAY_FILA_BALDES,
+    REPLAY_HEAP_MIN_MAX,
+    REPLAY_QUANTIDADE
+} BackendReplay;
+
+// Índices das operações nos contadores e histogramas
+enum {
+    REPLAY_OP_CHEGADA,
+    REPLAY_OP_EXTRAIR,
+    REPLAY_OP_REPRIORIZAR,
+    REPLAY_OP_REMOVER,
+    REPLAY_OP_QUANTIDADE
+};
+
+// Histograma log-linear de latência: 16 faixas por potência de 2 (erro
+// relativo abaixo de 7%), de 0 ns a 2^63 ns
+#define REPLAY_SUBFAIXAS 16
+#define REPLAY_FAIXAS_LATENCIA (REPLAY_SUBFAIXAS * 61)
+
+// Resultado de um replay
+typedef struct {
+    BackendReplay backend;
+    long long operacoes[REPLAY_OP_QUANTIDADE];
+    long long invalidas;         // Operações fora dos limites do cabeçalho (iguais em todas as filas)
+    long long semEfeito;         // Operações válidas ignoradas: id ausente ou chegada repetida. Podem
+                                 // variar entre as filas, que desempatam prioridades iguais de formas
+                                 // diferentes e por isso nem sempre atendem o mesmo paciente
+    long long obsoletas;         // Entradas antigas descartadas pela invalidação preguiçosa
+    long long atendidos;         // Extrações que devolveram um paciente
+    long long somaAtendidos;     // Soma das prioridades atendidas (para comparar filas)
+    long long tamanhoMaximo;     // Maior número de pacientes esperando
+    double nsOperacoes;          // Tempo somado das operações
+    double nsTotal;              // Tempo total, incluindo a leitura do trace
+    unsigned long long latencia[REPLAY_OP_QUANTIDADE][REPLAY_FAIXAS_LATENCIA];
+} ResultadoReplay;
+
+/**
+ * @brief Retorna o nome curto da fila (ex.: "max_heap").
+ */
+const char* nomeBackendReplay(BackendReplay backend);
+
+/**
+ * @brief Converte um nome curto em BackendReplay.
+ * @return HEAP_OK ou HEAP_ERRO_NAO_ENCONTRADO.
+ */
+int backendReplayPorNome(const char *nome, BackendReplay *backend);
+
+/**
+ * @brief Executa todas as operações do trace contra a fila escolhida.
+ * @param leitor Trace aberto (o cabeçalho define os limites de ids e prioridades).
+ * @param backend A fila a usar.
+ * @param resultado Recebe contadores, tempos e histogramas.
+ * @return HEAP_OK, HEAP_ERRO_PARAMETRO, HEAP_ERRO_MEMORIA ou HEAP_ERRO_ARQUIVO
+ * (trace malformado; o resultado cobre as operações lidas até o erro).
+ */
+int executarReplay(LeitorTrace *leitor, BackendReplay backend, ResultadoReplay *resultado);
+
+/**
+ * @brief Latência (ns) no percentil q (0 a 1) da operação 'op' (REPLAY_OP_*).
+ */
+double percentilReplay(const ResultadoReplay *resultado, int op, double q);
+
+/**
+ * @brief Imprime vazão, contadores e percentis de latência por operação.
+ */
+void imprimirResultadoReplay(const ResultadoReplay *resultado, FILE *saida);
+
+#endif // REPLAY_H
@@ -0,0 +1,170 @@
+#include "top_k.h"
+#include "heap_generico/heap_generico.h"
+#include <string.h> // memcpy
+
+// Instância do motor genérico só com as operações sobre array (Min-Heap).
+// Além de manter os k melhores, o Heapsort desta instância ordena em ordem
+// decrescente de prioridade.
+HEAP_GERAR_ARRAY(topKMin, Paciente, PACIENTE_MENOR)
+
+// Abaixo deste tamanho, o quickselect termina com ordenação por inserção
+#define SELECAO_LIMIAR_INSERCAO 16
+
+int topKPacientes(const Paciente array[], int n, int k, Paciente saida[]) {
+    if (array == NULL || saida == NULL || n < 0 || k < 0) {
+        return HEAP_ERRO_PARAMETRO;
+    }
+    int m = n < k ? n : k;
+    if (m == 0) {
+        return 0;
+    }
+    memcpy(saida, array, (size_t) m * sizeof(Paciente));
+    topKMinConstruir(saida, m);
+    for (int i = m; i < n; i++) {
+        if (array[i].prioridade > saida[0].prioridade) {
+            topKMinDescerValor(saida, m, 0, array[i]);
+        }
+    }
+    topKMinOrdenar(saida, m);
+    return m;
+}
+
+AcumuladorTopK* criarAcumuladorTopK(int k) {
+    if (k <= 0) {
+        return NULL;
+    }
+    AcumuladorTopK *acumulador = (AcumuladorTopK*) malloc(sizeof(AcumuladorTopK));
+    if (acumulador == NULL) {
+        perror("Falha ao alocar memória para o acumulador (AcumuladorTopK)");
+        return NULL;
+    }
+    acumulador->heap = (Paciente*) malloc((size_t) k * sizeof(Paciente));
+    if (acumulador->heap == NULL) {
+        perror("Falha ao alocar memória para a heap do acumulador (AcumuladorTopK)");
+        free(acumulador);
+        return NULL;
+    }
+    acumulador->k = k;
+    acumulador->tamanho = 0;
+    acumulador->vistos = 0;
+    return acumulador;
+}
+
+void adicionarPacienteTopK(AcumuladorTopK *acumulador, Paciente p) {
+    if (acumulador == NULL) return;
+    acumulador->vistos++;
+    if (acumulador->tamanho < acumulador->k) {
+        topKMinSubirValor(acumulador->heap, acumulador->tamanho++, p);
+    } else if (p.prioridade > acumulador->heap[0].prioridade) {
+        topKMinDescerValor(acumulador->heap, acumulador->k, 0, p);
+    }
+}
+
+void adicionarLoteTopK(AcumuladorTopK *acumulador, const Paciente lote[], int n) {
+    if (acumulador == NULL || lote == NULL) return;
+    int i = 0;
+    // Acumulador vazio: os primeiros k entram de uma vez com construção de Floyd
+    if (acumulador->tamanho == 0 && n > 0) {
+        i = n < acumulador->k ? n : acumulador->k;
+        memcpy(acumulador->heap, lote, (size_t) i * sizeof(Paciente));
+        acumulador->tamanho = i;
+        acumulador->vistos += i;
+        topKMinConstruir(acumulador->heap, i);
+    }
+    for (; i < n; i++) {
+        adicionarPacienteTopK(acumulador, lote[i]);
+    }
+}
+
+int consultarTopK(const AcumuladorTopK *acumulador, Paciente saida[]) {
+    if (acumulador == NULL || saida == NULL) return 0;
+    memcpy(saida, acumulador->heap, (size_t) acumulador->tamanho * sizeof(Paciente));
+    topKMinOrdenar(saida, acumulador->tamanho);
+    return acumulador->tamanho;
+}
+
+void limparAcumuladorTopK(AcumuladorTopK *acumulador) {
+    if (acumulador == NULL) return;
+    acumulador->tamanho = 0;
+    acumulador->vistos = 0;
+}
+
+void liberarAcumuladorTopK(AcumuladorTopK *acumulador) {
+    if (acumulador != NULL) {
+        free(acumulador->heap);
+        free(acumulador);
+    }
+}
+
+/**
+ * @brief Ordena array[inicio..fim] (inclusive) em ordem decrescente por inserção.
+ */
+static void ordenarInsercaoDecrescente(Paciente array[], int inicio, int fim) {
+    for (int i = inicio + 1; i <= fim; i++) {
+        Paciente x = array[i];
+        int j = i - 1;
+        while (j >= inicio && array[j].prioridade < x.prioridade) {
+            array[j + 1] = array[j];
+            j--;
+        }
+        array[j + 1] = x;
+    }
+}
+
+void selecionarNesimoPaciente(Paciente array[], int n, int k) {
+    if (array == NULL || k < 0 || k >= n) {
+        return;
+    }
+    int inicio = 0;
+    int fim = n - 1;
+    int profundidade = 0;
+    for (int m = n; m > 1; m >>= 1) {
+        profundidade += 2; // 2 * log2(n) partições antes do Heapsort
+    }
+
+    while (fim - inicio >= SELECAO_LIMIAR_INSERCAO) {
+        if (profundidade-- == 0) {
+            topKMinOrdenar(array + inicio, fim - inicio + 1); // Decrescente
+            return;
+        }
+        // Mediana de três: array[inicio] >= array[meio] >= array[fim]
+        int meio = inicio + (fim - inicio) / 2;
+        if (array[meio].prioridade > array[inicio].prioridade) topKMinTrocar(&array[meio], &array[inicio]);
+        if (array[fim].prioridade > array[inicio].prioridade) topKMinTrocar(&array[fim], &array[inicio]);
+        if (array[fim].prioridade > array[meio].prioridade) topKMinTrocar(&array[fim], &array[meio]);
+        int pivo = array[meio].prioridade;
+
+        // Partição de Hoare: [inicio..j] >= pivo e [i..fim] <= pivo
+        int i = inicio;
+        int j = fim;
+        while (i <= j) {
+            while (array[i].prioridade > pivo) i++;
+            while (array[j].prioridade < pivo) j--;
+            if (i <= j) {
+                topKMinTrocar(&array[i], &array[j]);
+                i++;
+                j--;
+            }
+        }
+        if (k <= j) {
+            fim = j;
+        } else if (k >= i) {
+            inicio = i;
+        } else {
+            return; // array[j+1..i-1] são iguais ao pivô
+        }
+    }
+    ordenarInsercaoDecrescente(array, inicio, fim);
+}
+
+void ordenarParcialPacientes(Paciente array[], int n, int k) {
+    if (array == NULL || n <= 1 || k <= 0) {
+        return;
+    }
+    if (k >= n) {
+        topKMinOrdenar(array, n);
+        return;
+    }
+    selecionarNesimoPaciente(array, n, k - 1);
+    topKMinOrdenar(array, k - 1); // array[k-1] já é o menor dos k primeiros
+}
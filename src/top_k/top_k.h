@@ -0,0 +1,102 @@
+#ifndef TOP_K_H
+#define TOP_K_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Seleção dos k pacientes mais urgentes sem ordenar a entrada inteira. Em
+// todas as funções, "mais urgente" é a maior prioridade e os resultados vêm
+// em ordem decrescente de prioridade.
+
+/**
+ * @brief Copia para 'saida' os k pacientes de maior prioridade de 'array', em
+ * ordem decrescente de prioridade, em tempo O(n log k). Mantém uma Min-Heap
+ * limitada a k elementos (o menor dos k melhores na raiz) dentro de 'saida';
+ * cada paciente só entra se superar a raiz. 'array' não é alterado.
+ * @param array O array de Pacientes.
+ * @param n O número de elementos no array.
+ * @param k Quantos pacientes selecionar.
+ * @param saida Array com espaço para ao menos k pacientes.
+ * @return Número de pacientes gravados (min(n, k)), ou HEAP_ERRO_PARAMETRO.
+ */
+int topKPacientes(const Paciente array[], int n, int k, Paciente saida[]);
+
+// Acumulador de top-k para fluxos de pacientes: recebe pacientes um a um ou em
+// lotes e pode ser consultado a qualquer momento.
+typedef struct {
+    Paciente *heap;  // Min-Heap dos k melhores vistos até agora
+    int k;           // Capacidade (número de pacientes mantidos)
+    int tamanho;     // Pacientes atualmente na heap (até k)
+    long long vistos; // Total de pacientes recebidos
+} AcumuladorTopK;
+
+/**
+ * @brief Cria um acumulador dos k pacientes de maior prioridade.
+ * @param k Quantos pacientes manter (k > 0).
+ * @return Ponteiro para o AcumuladorTopK criado, ou NULL em caso de falha.
+ */
+AcumuladorTopK* criarAcumuladorTopK(int k);
+
+/**
+ * @brief Oferece um paciente ao acumulador em O(log k) (O(1) quando ele não
+ * supera o menor dos k melhores).
+ * @param acumulador Ponteiro para o AcumuladorTopK.
+ * @param p O Paciente oferecido.
+ */
+void adicionarPacienteTopK(AcumuladorTopK *acumulador, Paciente p);
+
+/**
+ * @brief Oferece um lote de pacientes ao acumulador.
+ * @param acumulador Ponteiro para o AcumuladorTopK.
+ * @param lote O array de Pacientes.
+ * @param n O número de pacientes no lote.
+ */
+void adicionarLoteTopK(AcumuladorTopK *acumulador, const Paciente lote[], int n);
+
+/**
+ * @brief Copia os melhores pacientes vistos até agora para 'saida', em ordem
+ * decrescente de prioridade (O(k log k)). O acumulador não é alterado.
+ * @param acumulador Ponteiro para o AcumuladorTopK.
+ * @param saida Array com espaço para ao menos k pacientes.
+ * @return Número de pacientes gravados (min(vistos, k)).
+ */
+int consultarTopK(const AcumuladorTopK *acumulador, Paciente saida[]);
+
+/**
+ * @brief Esvazia o acumulador, mantendo k.
+ * @param acumulador Ponteiro para o AcumuladorTopK.
+ */
+void limparAcumuladorTopK(AcumuladorTopK *acumulador);
+
+/**
+ * @brief Libera a memória alocada para o acumulador.
+ * @param acumulador Ponteiro para o AcumuladorTopK a ser liberado.
+ */
+void liberarAcumuladorTopK(AcumuladorTopK *acumulador);
+
+/**
+ * @brief Reorganiza 'array' in-place de forma que array[k] seja o paciente que
+ * ocuparia a posição k em ordem decrescente de prioridade, com prioridades
+ * maiores ou iguais antes dele e menores ou iguais depois (nth-element).
+ * Quickselect com mediana de três em tempo O(n) esperado; se a recursão ficar
+ * profunda demais, o trecho restante é ordenado por Heapsort (O(n log n) no
+ * pior caso).
+ * @param array O array de Pacientes.
+ * @param n O número de elementos no array.
+ * @param k Posição desejada (0 <= k < n).
+ */
+void selecionarNesimoPaciente(Paciente array[], int n, int k);
+
+/**
+ * @brief Ordenação parcial: coloca em array[0..k) os k pacientes de maior
+ * prioridade, em ordem decrescente; o restante fica em ordem arbitrária.
+ * Tempo O(n + k log k) esperado.
+ * @param array O array de Pacientes.
+ * @param n O número de elementos no array.
+ * @param k Quantos pacientes ordenar no início do array.
+ */
+void ordenarParcialPacientes(Paciente array[], int n, int k);
+
+#endif // TOP_K_H
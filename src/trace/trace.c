@@ -0,0 +1,395 @@
+#include "trace.h"
+#include "indexed_heap/indexed_heap.h" // Estado da fila simulado pelo gerador
+#include <stdint.h> // uint32_t, uint64_t
+#include <string.h> // memcmp, memmove, memcpy, strcmp
+
+// Maior linha aceita no formato texto
+#define TRACE_MAXIMO_LINHA 256
+
+// Bytes do cabeçalho binário: mágico + idMaximo + prioridadeMaxima
+#define TRACE_CABECALHO_BINARIO 16
+
+static void escreverInt32(char *destino, int valor) {
+    uint32_t v = (uint32_t) valor;
+    destino[0] = (char) (v & 0xFFu);
+    destino[1] = (char) ((v >> 8) & 0xFFu);
+    destino[2] = (char) ((v >> 16) & 0xFFu);
+    destino[3] = (char) (v >> 24);
+}
+
+static int lerInt32(const char *origem) {
+    const unsigned char *b = (const unsigned char*) origem;
+    uint32_t v = (uint32_t) b[0] | ((uint32_t) b[1] << 8) | ((uint32_t) b[2] << 16) | ((uint32_t) b[3] << 24);
+    return (int) v;
+}
+
+/**
+ * @brief Garante ao menos 'n' bytes não consumidos no buffer, movendo o resto
+ * para o início e lendo o próximo bloco. Retorna 0 se o arquivo acabar antes.
+ */
+static int garantirBytes(LeitorTrace *leitor, size_t n) {
+    while (leitor->fim - leitor->inicio < n) {
+        if (leitor->fimArquivo) {
+            return 0;
+        }
+        if (leitor->inicio > 0) {
+            memmove(leitor->buffer, leitor->buffer + leitor->inicio, leitor->fim - leitor->inicio);
+            leitor->fim -= leitor->inicio;
+            leitor->inicio = 0;
+        }
+        size_t lidos = fread(leitor->buffer + leitor->fim, 1, TRACE_BUFFER - leitor->fim, leitor->arquivo);
+        leitor->fim += lidos;
+        if (lidos == 0) {
+            leitor->fimArquivo = 1;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief Retorna a próxima linha do trace texto (terminada em '\0', sem o
+ * '\n'), ou NULL no fim do arquivo. *erro vira 1 se a linha for longa demais.
+ */
+static char* proximaLinha(LeitorTrace *leitor, int *erro) {
+    *erro = 0;
+    for (;;) {
+        char *inicio = leitor->buffer + leitor->inicio;
+        char *nl = memchr(inicio, '\n', leitor->fim - leitor->inicio);
+        if (nl != NULL) {
+            *nl = '\0';
+            leitor->inicio = (size_t) (nl - leitor->buffer) + 1;
+            leitor->linha++;
+            return inicio;
+        }
+        size_t pendentes = leitor->fim - leitor->inicio;
+        if (leitor->fimArquivo) {
+            if (pendentes == 0) {
+                return NULL;
+            }
+            // Última linha sem '\n': há espaço porque o buffer é maior que uma linha
+            leitor->buffer[leitor->fim] = '\0';
+            leitor->inicio = leitor->fim;
+            leitor->linha++;
+            return inicio;
+        }
+        if (pendentes > TRACE_MAXIMO_LINHA) {
+            *erro = 1;
+            return NULL;
+        }
+        garantirBytes(leitor, pendentes + 1);
+    }
+}
+
+// Lê um inteiro decimal de *p, avançando o cursor. Retorna 0 se não houver.
+static int lerInteiro(char **p, int *valor) {
+    char *fimNumero;
+    long v = strtol(*p, &fimNumero, 10);
+    if (fimNumero == *p || v < INT32_MIN || v > INT32_MAX) {
+        return 0;
+    }
+    *valor = (int) v;
+    *p = fimNumero;
+    return 1;
+}
+
+// Verifica se só há espaços ou um comentário até o fim da linha
+static int restoVazio(const char *p) {
+    while (*p == ' ' || *p == '\t' || *p == '\r') {
+        p++;
+    }
+    return *p == '\0' || *p == '#';
+}
+
+LeitorTrace* abrirLeitorTrace(const char *caminho) {
+    if (caminho == NULL) return NULL;
+    LeitorTrace *leitor = (LeitorTrace*) calloc(1, sizeof(LeitorTrace));
+    if (leitor == NULL) {
+        perror("Falha ao alocar memória para o leitor de trace");
+        return NULL;
+    }
+    // Um byte extra para terminar a última linha de um trace texto
+    leitor->buffer = (char*) malloc(TRACE_BUFFER + 1);
+    if (strcmp(caminho, "-") == 0) {
+        leitor->arquivo = stdin;
+    } else {
+        leitor->arquivo = fopen(caminho, "rb");
+        leitor->fecharArquivo = 1;
+    }
+    if (leitor->buffer == NULL || leitor->arquivo == NULL) {
+        perror("Falha ao abrir o trace");
+        fecharLeitorTrace(leitor);
+        return NULL;
+    }
+
+    garantirBytes(leitor, TRACE_CABECALHO_BINARIO);
+    size_t magico = sizeof(TRACE_MAGICO_BINARIO) - 1;
+    if (leitor->fim >= magico && memcmp(leitor->buffer, TRACE_MAGICO_BINARIO, magico) == 0) {
+        if (leitor->fim < TRACE_CABECALHO_BINARIO) {
+            fprintf(stderr, "Trace binário truncado no cabeçalho\n");
+            fecharLeitorTrace(leitor);
+            return NULL;
+        }
+        leitor->binario = 1;
+        leitor->cabecalho.idMaximo = lerInt32(leitor->buffer + 8);
+        leitor->cabecalho.prioridadeMaxima = lerInt32(leitor->buffer + 12);
+        leitor->inicio = TRACE_CABECALHO_BINARIO;
+    } else {
+        int erro;
+        char *linha;
+        do {
+            linha = proximaLinha(leitor, &erro);
+        } while (linha != NULL && restoVazio(linha));
+        char palavra[16];
+        if (linha == NULL || sscanf(linha, "%15s %d %d", palavra, &leitor->cabecalho.idMaximo,
+                                    &leitor->cabecalho.prioridadeMaxima) != 3 ||
+            strcmp(palavra, "HEAPTRACE") != 0) {
+            fprintf(stderr, "Trace sem cabeçalho (esperado \"HEAPTRACE <idMaximo> <prioridadeMaxima>\")\n");
+            fecharLeitorTrace(leitor);
+            return NULL;
+        }
+    }
+    if (leitor->cabecalho.idMaximo < 0 || leitor->cabecalho.prioridadeMaxima < 0) {
+        fprintf(stderr, "Cabeçalho de trace inválido\n");
+        fecharLeitorTrace(leitor);
+        return NULL;
+    }
+    return leitor;
+}
+
+int lerOperacaoTrace(LeitorTrace *leitor, OperacaoTrace *op) {
+    if (leitor == NULL || op == NULL) return HEAP_ERRO_PARAMETRO;
+    op->id = -1;
+    op->prioridade = -1;
+    if (leitor->binario) {
+        if (!garantirBytes(leitor, 1)) {
+            return 0;
+        }
+        char tipo = leitor->buffer[leitor->inicio];
+        size_t campos = tipo == TRACE_CHEGADA || tipo == TRACE_REPRIORIZAR ? 2
+                      : tipo == TRACE_REMOVER ? 1
+                      : tipo == TRACE_EXTRAIR ? 0 : 3;
+        if (campos == 3 || !garantirBytes(leitor, 1 + 4 * campos)) {
+            fprintf(stderr, "Trace binário malformado ou truncado\n");
+            return HEAP_ERRO_ARQUIVO;
+        }
+        const char *dados = leitor->buffer + leitor->inicio + 1;
+        op->tipo = (TipoOperacaoTrace) tipo;
+        if (campos >= 1) op->id = lerInt32(dados);
+        if (campos == 2) op->prioridade = lerInt32(dados + 4);
+        leitor->inicio += 1 + 4 * campos;
+        return 1;
+    }
+
+    int erro;
+    char *linha;
+    do {
+        linha = proximaLinha(leitor, &erro);
+    } while (linha != NULL && restoVazio(linha));
+    if (linha == NULL) {
+        if (erro) {
+            fprintf(stderr, "Linha %lld do trace longa demais\n", leitor->linha + 1);
+            return HEAP_ERRO_ARQUIVO;
+        }
+        return 0;
+    }
+    char *p = linha;
+    while (*p == ' ' || *p == '\t') {
+        p++;
+    }
+    op->tipo = (TipoOperacaoTrace) *p++;
+    int ok;
+    switch (op->tipo) {
+        case TRACE_CHEGADA:
+        case TRACE_REPRIORIZAR:
+            ok = lerInteiro(&p, &op->id) && lerInteiro(&p, &op->prioridade);
+            break;
+        case TRACE_REMOVER:
+            ok = lerInteiro(&p, &op->id);
+            break;
+        case TRACE_EXTRAIR:
+            ok = 1;
+            break;
+        default:
+            ok = 0;
+            break;
+    }
+    if (!ok || !restoVazio(p)) {
+        fprintf(stderr, "Linha %lld do trace malformada\n", leitor->linha);
+        return HEAP_ERRO_ARQUIVO;
+    }
+    return 1;
+}
+
+void fecharLeitorTrace(LeitorTrace *leitor) {
+    if (leitor != NULL) {
+        if (leitor->fecharArquivo && leitor->arquivo != NULL) {
+            fclose(leitor->arquivo);
+        }
+        free(leitor->buffer);
+        free(leitor);
+    }
+}
+
+static void descarregarEscritor(EscritorTrace *escritor) {
+    if (escritor->usado > 0 && fwrite(escritor->buffer, 1, escritor->usado, escritor->arquivo) != escritor->usado) {
+        escritor->erro = 1;
+    }
+    escritor->usado = 0;
+}
+
+EscritorTrace* abrirEscritorTrace(const char *caminho, int binario, CabecalhoTrace cabecalho) {
+    if (caminho == NULL) return NULL;
+    EscritorTrace *escritor = (EscritorTrace*) calloc(1, sizeof(EscritorTrace));
+    if (escritor == NULL) {
+        perror("Falha ao alocar memória para o escritor de trace");
+        return NULL;
+    }
+    escritor->buffer = (char*) malloc(TRACE_BUFFER);
+    escritor->arquivo = strcmp(caminho, "-") == 0 ? stdout : fopen(caminho, "wb");
+    if (escritor->buffer == NULL || escritor->arquivo == NULL) {
+        perror("Falha ao criar o trace");
+        if (escritor->arquivo != NULL && escritor->arquivo != stdout) fclose(escritor->arquivo);
+        free(escritor->buffer);
+        free(escritor);
+        return NULL;
+    }
+    escritor->binario = binario;
+    if (binario) {
+        memcpy(escritor->buffer, TRACE_MAGICO_BINARIO, 8);
+        escreverInt32(escritor->buffer + 8, cabecalho.idMaximo);
+        escreverInt32(escritor->buffer + 12, cabecalho.prioridadeMaxima);
+        escritor->usado = TRACE_CABECALHO_BINARIO;
+    } else {
+        escritor->usado = (size_t) sprintf(escritor->buffer, "HEAPTRACE %d %d\n", cabecalho.idMaximo,
+                                           cabecalho.prioridadeMaxima);
+    }
+    return escritor;
+}
+
+int escreverOperacaoTrace(EscritorTrace *escritor, OperacaoTrace op) {
+    if (escritor == NULL) return HEAP_ERRO_PARAMETRO;
+    if (TRACE_BUFFER - escritor->usado < 32) {
+        descarregarEscritor(escritor);
+    }
+    char *destino = escritor->buffer + escritor->usado;
+    if (escritor->binario) {
+        destino[0] = (char) op.tipo;
+        size_t n = 1;
+        if (op.tipo != TRACE_EXTRAIR) {
+            escreverInt32(destino + n, op.id);
+            n += 4;
+        }
+        if (op.tipo == TRACE_CHEGADA || op.tipo == TRACE_REPRIORIZAR) {
+            escreverInt32(destino + n, op.prioridade);
+            n += 4;
+        }
+        escritor->usado += n;
+    } else if (op.tipo == TRACE_EXTRAIR) {
+        escritor->usado += (size_t) sprintf(destino, "e\n");
+    } else if (op.tipo == TRACE_REMOVER) {
+        escritor->usado += (size_t) sprintf(destino, "r %d\n", op.id);
+    } else {
+        escritor->usado += (size_t) sprintf(destino, "%c %d %d\n", (char) op.tipo, op.id, op.prioridade);
+    }
+    return escritor->erro ? HEAP_ERRO_ARQUIVO : HEAP_OK;
+}
+
+int fecharEscritorTrace(EscritorTrace *escritor) {
+    if (escritor == NULL) return HEAP_ERRO_PARAMETRO;
+    descarregarEscritor(escritor);
+    if (fflush(escritor->arquivo) != 0) {
+        escritor->erro = 1;
+    }
+    if (escritor->arquivo != stdout && fclose(escritor->arquivo) != 0) {
+        escritor->erro = 1;
+    }
+    int status = escritor->erro ? HEAP_ERRO_ARQUIVO : HEAP_OK;
+    free(escritor->buffer);
+    free(escritor);
+    return status;
+}
+
+void parametrosTracePadrao(ParametrosTrace *p) {
+    p->operacoes = 1000000;
+    p->semente = 1;
+    p->prioridadeMaxima = 999;
+    p->taxaChegada = 0.45;
+    p->taxaChegadaRajada = 0.9;
+    p->probabilidadeRajada = 0.00005;
+    p->duracaoRajada = 2000;
+    p->fracaoRepriorizar = 0.05;
+    p->fracaoRemover = 0.02;
+}
+
+// Gerador xorshift64* reprodutível; retorna um valor uniforme em [0, 1)
+static double aleatorioTrace(uint64_t *estado) {
+    *estado ^= *estado >> 12;
+    *estado ^= *estado << 25;
+    *estado ^= *estado >> 27;
+    return (double) ((*estado * 2685821657736338717ULL) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static int aleatorioAte(uint64_t *estado, int n) {
+    return (int) (aleatorioTrace(estado) * n);
+}
+
+int gerarTraceSintetico(const char *caminho, int binario, const ParametrosTrace *p) {
+    if (p == NULL || p->operacoes < 0 || p->operacoes > INT32_MAX || p->prioridadeMaxima < 0 ||
+        p->prioridadeMaxima == INT32_MAX || p->duracaoRajada < 1) {
+        return HEAP_ERRO_PARAMETRO;
+    }
+    // Cada chegada usa um id novo, então os ids cabem em [0, operacoes]
+    int idMaximo = (int) p->operacoes;
+    IndexedHeap *fila = criarIndexedHeap(idMaximo);
+    if (fila == NULL) {
+        return HEAP_ERRO_MEMORIA;
+    }
+    CabecalhoTrace cabecalho = {idMaximo, p->prioridadeMaxima};
+    EscritorTrace *escritor = abrirEscritorTrace(caminho, binario, cabecalho);
+    if (escritor == NULL) {
+        liberarIndexedHeap(fila);
+        return HEAP_ERRO_ARQUIVO;
+    }
+
+    uint64_t estado = 0x9E3779B97F4A7C15ULL ^ p->semente;
+    int proximoId = 0;
+    long long rajadaRestante = 0;
+    int status = HEAP_OK;
+    for (long long i = 0; i < p->operacoes && status == HEAP_OK; i++) {
+        if (rajadaRestante == 0 && aleatorioTrace(&estado) < p->probabilidadeRajada) {
+            // Duração uniforme em [d/2, 3d/2]
+            rajadaRestante = p->duracaoRajada / 2 + aleatorioAte(&estado, p->duracaoRajada + 1);
+        }
+        double taxa = rajadaRestante > 0 ? p->taxaChegadaRajada : p->taxaChegada;
+        if (rajadaRestante > 0) {
+            rajadaRestante--;
+        }
+
+        OperacaoTrace op;
+        double u = aleatorioTrace(&estado);
+        if (fila->tamanho > 0 && u < p->fracaoRepriorizar) {
+            op.tipo = TRACE_REPRIORIZAR;
+            op.id = fila->array[aleatorioAte(&estado, fila->tamanho)].id;
+            op.prioridade = aleatorioAte(&estado, p->prioridadeMaxima + 1);
+            atualizarPrioridade(fila, op.id, op.prioridade);
+        } else if (fila->tamanho > 0 && u < p->fracaoRepriorizar + p->fracaoRemover) {
+            op.tipo = TRACE_REMOVER;
+            op.id = fila->array[aleatorioAte(&estado, fila->tamanho)].id;
+            op.prioridade = -1;
+            removerPaciente(fila, op.id);
+        } else if (fila->tamanho == 0 || aleatorioTrace(&estado) < taxa) {
+            op.tipo = TRACE_CHEGADA;
+            op.id = proximoId++;
+            op.prioridade = aleatorioAte(&estado, p->prioridadeMaxima + 1);
+            inserirPacienteIndexed(fila, (Paciente){op.id, op.prioridade});
+        } else {
+            op.tipo = TRACE_EXTRAIR;
+            op.id = op.prioridade = -1;
+            extrairMaxPacienteIndexed(fila);
+        }
+        status = escreverOperacaoTrace(escritor, op);
+    }
+    int statusFechar = fecharEscritorTrace(escritor);
+    liberarIndexedHeap(fila);
+    return status != HEAP_OK ? status : statusFechar;
+}
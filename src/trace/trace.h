@@ -0,0 +1,149 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdio.h>
+#include <stdlib.h> // Para malloc, free
+#include "includes/paciente.h" // Inclui a definição da struct Paciente
+#include "includes/heap_status.h" // Códigos de retorno (HeapStatus)
+
+// Traces de operações de fila para replay (programa_hospital --replay).
+//
+// Formato texto: uma operação por linha, linhas vazias e '#' ignorados.
+//     HEAPTRACE <idMaximo> <prioridadeMaxima>   (cabeçalho, primeira linha)
+//     c <id> <prioridade>                       chegada
+//     e                                         extração do mais urgente
+//     p <id> <prioridade>                       nova prioridade
+//     r <id>                                    remoção (desistência)
+//
+// Formato binário: os 8 bytes "HEAPTRB1", idMaximo e prioridadeMaxima
+// (int32 little-endian) e, por operação, um byte com a letra da operação
+// seguido só dos campos dela em int32 little-endian (1 a 9 bytes).
+//
+// O leitor detecta o formato pelo início do arquivo e lê em blocos grandes
+// (TRACE_BUFFER bytes), inclusive da entrada padrão.
+
+// Tamanho do buffer de leitura e escrita
+#define TRACE_BUFFER (1 << 20)
+
+// Identificação do formato binário
+#define TRACE_MAGICO_BINARIO "HEAPTRB1"
+
+typedef enum {
+    TRACE_CHEGADA = 'c',
+    TRACE_EXTRAIR = 'e',
+    TRACE_REPRIORIZAR = 'p',
+    TRACE_REMOVER = 'r'
+} TipoOperacaoTrace;
+
+// Uma operação do trace (id e prioridade só quando a operação os usa)
+typedef struct {
+    TipoOperacaoTrace tipo;
+    int id;
+    int prioridade;
+} OperacaoTrace;
+
+// Limites declarados no cabeçalho: ids em [0, idMaximo] e prioridades em
+// [0, prioridadeMaxima]
+typedef struct {
+    int idMaximo;
+    int prioridadeMaxima;
+} CabecalhoTrace;
+
+// Leitor de trace com buffer próprio
+typedef struct {
+    FILE *arquivo;
+    int fecharArquivo;  // 0 para a entrada padrão
+    int binario;
+    char *buffer;
+    size_t inicio;      // Próximo byte a consumir
+    size_t fim;         // Bytes válidos no buffer
+    int fimArquivo;
+    long long linha;    // Linha atual (formato texto), para mensagens de erro
+    CabecalhoTrace cabecalho;
+} LeitorTrace;
+
+// Escritor de trace com buffer próprio
+typedef struct {
+    FILE *arquivo;
+    int binario;
+    char *buffer;
+    size_t usado;
+    int erro;
+} EscritorTrace;
+
+// Parâmetros do gerador sintético: alterna entre períodos normais e rajadas
+// de chegada (ex.: um acidente com várias vítimas), com parte das operações
+// mudando a prioridade ou removendo pacientes que ainda esperam.
+typedef struct {
+    long long operacoes;       // Total de operações do trace
+    unsigned int semente;
+    int prioridadeMaxima;      // Prioridades em [0, prioridadeMaxima]
+    double taxaChegada;        // Fração de chegadas fora das rajadas (< 0.5 esvazia a fila)
+    double taxaChegadaRajada;  // Fração de chegadas durante uma rajada
+    double probabilidadeRajada; // Chance, por operação, de começar uma rajada
+    int duracaoRajada;         // Duração média de uma rajada, em operações
+    double fracaoRepriorizar;  // Fração das operações que mudam uma prioridade
+    double fracaoRemover;      // Fração das operações que removem um paciente
+} ParametrosTrace;
+
+/**
+ * @brief Abre um trace para leitura e lê o cabeçalho.
+ * @param caminho Caminho do arquivo, ou "-" para a entrada padrão.
+ * @return Ponteiro para o LeitorTrace, ou NULL se o arquivo não puder ser
+ * aberto ou o cabeçalho for inválido.
+ */
+LeitorTrace* abrirLeitorTrace(const char *caminho);
+
+/**
+ * @brief Lê a próxima operação.
+ * @param leitor Ponteiro para o LeitorTrace.
+ * @param op Recebe a operação.
+ * @return 1 se leu uma operação, 0 no fim do trace ou HEAP_ERRO_ARQUIVO se o
+ * trace estiver malformado ou truncado.
+ */
+int lerOperacaoTrace(LeitorTrace *leitor, OperacaoTrace *op);
+
+/**
+ * @brief Fecha o trace e libera o leitor.
+ */
+void fecharLeitorTrace(LeitorTrace *leitor);
+
+/**
+ * @brief Cria um trace e escreve o cabeçalho.
+ * @param caminho Caminho do arquivo, ou "-" para a saída padrão.
+ * @param binario 1 para o formato binário, 0 para texto.
+ * @param cabecalho Limites de ids e prioridades do trace.
+ * @return Ponteiro para o EscritorTrace, ou NULL em caso de falha.
+ */
+EscritorTrace* abrirEscritorTrace(const char *caminho, int binario, CabecalhoTrace cabecalho);
+
+/**
+ * @brief Acrescenta uma operação ao trace.
+ * @return HEAP_OK ou HEAP_ERRO_ARQUIVO.
+ */
+int escreverOperacaoTrace(EscritorTrace *escritor, OperacaoTrace op);
+
+/**
+ * @brief Descarrega o buffer, fecha o trace e libera o escritor.
+ * @return HEAP_OK, ou HEAP_ERRO_ARQUIVO se alguma escrita falhou.
+ */
+int fecharEscritorTrace(EscritorTrace *escritor);
+
+/**
+ * @brief Preenche 'p' com os parâmetros padrão do gerador: 10^6 operações,
+ * prioridades em [0, 999], fila que esvazia entre rajadas de ~2000 chegadas.
+ */
+void parametrosTracePadrao(ParametrosTrace *p);
+
+/**
+ * @brief Gera um trace sintético. O estado da fila é simulado com uma
+ * IndexedHeap, de modo que extrações, mudanças de prioridade e remoções só
+ * são emitidas quando há pacientes esperando e sempre se referem a eles.
+ * @param caminho Caminho do arquivo, ou "-" para a saída padrão.
+ * @param binario 1 para o formato binário, 0 para texto.
+ * @param p Parâmetros do gerador.
+ * @return HEAP_OK, HEAP_ERRO_PARAMETRO, HEAP_ERRO_MEMORIA ou HEAP_ERRO_ARQUIVO.
+ */
+int gerarTraceSintetico(const char *caminho, int binario, const ParametrosTrace *p);
+
+#endif // TRACE_H